@@ -11,6 +11,15 @@
 #include "AI/SolaraqAIController.h"
 #include "Pawns/SolaraqEnemyShip.h"
 #include "Components/SphereComponent.h"
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h"
+#include "Benchmark/SolaraqBenchmarkStats.h"
+#include "AI/SolaraqObstacleFieldSubsystem.h"
+#include "AI/SolaraqLineOfSightSubsystem.h"
+#include "AI/SolaraqSquadSubsystem.h"
+#include "AI/SolaraqNavGraphSubsystem.h"
+#include "AI/SolaraqThreatMapSubsystem.h"
+#include "AI/SolaraqAIProfile.h"
+#include "Engine/AssetManager.h"
 
 
 bool ASolaraqAIController::CalculateInterceptPoint(
@@ -122,44 +131,24 @@ FGenericTeamId ASolaraqAIController::GetGenericTeamId() const
     return TeamId;
 }
 
-ETeamAttitude::Type ASolaraqAIController::GetTeamAttitudeTowards(const AActor& Other) const
+void ASolaraqAIController::SetGenericTeamId(const FGenericTeamId& NewTeamId)
 {
-    if (const APawn* OtherPawn = Cast<const APawn>(&Other))
-    {
-        // --- Check 1: Try getting team from the Other's CONTROLLER first ---
-        if (const IGenericTeamAgentInterface* TeamAgentController = Cast<const IGenericTeamAgentInterface>(OtherPawn->GetController()))
-        {
-            FGenericTeamId OtherTeamId = TeamAgentController->GetGenericTeamId();
-            if (OtherTeamId == TeamId) { return ETeamAttitude::Friendly; }
-            if (OtherTeamId.GetId() != FGenericTeamId::NoTeam.GetId()) { return ETeamAttitude::Hostile; }
-            // If Controller is NoTeam or doesn't implement, fall through...
-        }
+    Super::SetGenericTeamId(NewTeamId);
+    TeamId = NewTeamId;
 
-        // --- Check 2: Try getting team from the Other PAWN itself ---
-        if (const IGenericTeamAgentInterface* TeamAgentPawn = Cast<const IGenericTeamAgentInterface>(OtherPawn))
-        {
-            FGenericTeamId OtherTeamId = TeamAgentPawn->GetGenericTeamId();
-            if (OtherTeamId == TeamId) { return ETeamAttitude::Friendly; }
-            if (OtherTeamId.GetId() != FGenericTeamId::NoTeam.GetId()) { return ETeamAttitude::Hostile; }
-             // If Pawn is NoTeam or doesn't implement, fall through...
-        }
-
-        // --- Fallback: If specifically controlled by a PlayerController (and checks above failed) ---
-        // This helps if the player pawn *doesn't* have the interface but the controller is identifiable.
-        // NOTE: Be careful, this assumes ALL players are hostile if not otherwise specified.
-        if (Cast<APlayerController>(OtherPawn->GetController()))
-        {
-             return ETeamAttitude::Hostile;
-        }
-    }
-    // --- Check 3: Check non-Pawns directly (e.g., turrets?) ---
-    else if (const IGenericTeamAgentInterface* TeamAgent = Cast<const IGenericTeamAgentInterface>(&Other))
+    if (ASolaraqShipBase* Ship = Cast<ASolaraqShipBase>(GetPawn()))
     {
-         FGenericTeamId OtherTeamId = TeamAgent->GetGenericTeamId();
-         if (OtherTeamId == TeamId) { return ETeamAttitude::Friendly; }
-         if (OtherTeamId.GetId() != FGenericTeamId::NoTeam.GetId()) { return ETeamAttitude::Hostile; }
+        Ship->RefreshTeamRegistration();
     }
+}
 
+ETeamAttitude::Type ASolaraqAIController::GetTeamAttitudeTowards(const AActor& Other) const
+{
+    // Cached registry lookup + faction matrix (see USolaraqTeamSubsystem)
+    if (const USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this))
+    {
+        return Teams->GetAttitudeTowards(TeamId, Other);
+    }
 
     // Default attitude towards everything else
     return ETeamAttitude::Neutral;
@@ -190,10 +179,162 @@ void ASolaraqAIController::OnPossess(APawn* InPawn)
     {
         UE_LOG(LogSolaraqSystem, Error, TEXT("PerceptionComponent is null on %s during OnPossess!"), *GetName());
     }
+
+    // --- Join the squad brain (target assignment is done per squad, not per ship) ---
+    if (USolaraqSquadSubsystem* Squads = USolaraqSquadSubsystem::Get(this))
+    {
+        Squads->RegisterMember(this);
+    }
+
+    // --- Tuning profile (already loaded on re-possess, otherwise streamed in) ---
+    if (ActiveProfile || ProfileLoadHandle.IsValid())
+    {
+        ApplyProfileToShip();
+    }
+    else
+    {
+        SetBehaviorProfile(BehaviorProfile);
+    }
+}
+
+void ASolaraqAIController::OnUnPossess()
+{
+    if (USolaraqSquadSubsystem* Squads = USolaraqSquadSubsystem::Get(this))
+    {
+        Squads->UnregisterMember(this);
+    }
+    BreakFormation(); // Leader lost: followers go back to full AI. Follower lost: leave the slot free.
+    ClearSquadOrders();
+    PerceivedHostiles.Reset();
+
+    Super::OnUnPossess();
+}
+
+void ASolaraqAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USolaraqSquadSubsystem* Squads = USolaraqSquadSubsystem::Get(this))
+    {
+        Squads->UnregisterMember(this);
+    }
+
+    if (ProfileLoadHandle.IsValid())
+    {
+        ProfileLoadHandle->CancelHandle();
+        ProfileLoadHandle.Reset();
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+// --- Behavior Profile ---
+
+void ASolaraqAIController::SetBehaviorProfile(TSoftObjectPtr<USolaraqAIProfile> NewProfile)
+{
+    BehaviorProfile = NewProfile;
+    if (ProfileLoadHandle.IsValid())
+    {
+        ProfileLoadHandle->CancelHandle();
+        ProfileLoadHandle.Reset();
+    }
+
+    if (BehaviorProfile.IsNull())
+    {
+        ActiveProfile = nullptr;
+        ApplyProfileToShip();
+        return;
+    }
+
+    // Another ship probably loaded it already; no need to go through the streamer
+    if (USolaraqAIProfile* Resident = BehaviorProfile.Get())
+    {
+        ActiveProfile = Resident;
+        ApplyProfileToShip();
+        return;
+    }
+
+    ProfileLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(BehaviorProfile.ToSoftObjectPath(),
+        FStreamableDelegate::CreateUObject(this, &ASolaraqAIController::HandleProfileLoaded));
+}
+
+void ASolaraqAIController::HandleProfileLoaded()
+{
+    if (USolaraqAIProfile* Loaded = BehaviorProfile.Get())
+    {
+        ActiveProfile = Loaded;
+        ApplyProfileToShip();
+    }
+    else
+    {
+        UE_LOG(LogSolaraqAI, Warning, TEXT("%s: Failed to load AI profile %s, keeping the current one."), *GetName(), *BehaviorProfile.ToString());
+    }
+}
+
+void ASolaraqAIController::ApplyProfileToShip()
+{
+    if (ControlledEnemyShip)
+    {
+        ControlledEnemyShip->SetAIProfile(ActiveProfile);
+    }
+}
+
+const FSolaraqDogfightTuning& ASolaraqAIController::GetDogfightTuning() const
+{
+    return (ActiveProfile ? *ActiveProfile : USolaraqAIProfile::GetDefaultProfile()).Dogfight;
+}
+
+void ASolaraqAIController::ApplySquadOrders(AActor* AssignedTarget, int32 OffsetSide)
+{
+    if (!AssignedTarget)
+    {
+        ClearSquadOrders();
+        return;
+    }
+
+    bHasSquadOrders = true;
+    SquadOffsetSide = (OffsetSide >= 0) ? 1 : -1;
+
+    // Same as contact through our own perception: the formation turns into a fight
+    if (FormationFollowers.Num() > 0)
+    {
+        UE_LOG(LogSolaraqAI, Log, TEXT("%s Formation breaking, squad assigned %s."), *GetName(), *AssignedTarget->GetName());
+        BreakFormation();
+    }
+
+    if (CurrentTargetActor != AssignedTarget)
+    {
+        UE_LOG(LogSolaraqAI, Log, TEXT("%s Squad assigned target %s (OffsetSide = %d)"), *GetName(), *AssignedTarget->GetName(), SquadOffsetSide);
+        CurrentTargetActor = AssignedTarget;
+        PredictedAimLocation = AssignedTarget->GetActorLocation();
+        // Restart the approach so the assigned side is picked up
+        CurrentDogfightState = EDogfightState::OffsetApproach;
+        TimeInCurrentDogfightState = 0.0f;
+    }
+    LastKnownTargetLocation = AssignedTarget->GetActorLocation();
+
+    // A squad mate perceives it; the LoS service in Tick still decides whether we can actually see it
+    bTargetPerceived = true;
+}
+
+void ASolaraqAIController::ClearSquadOrders()
+{
+    if (!bHasSquadOrders)
+    {
+        return;
+    }
+    bHasSquadOrders = false;
+
+    // Back to our own picture: only keep the target if we perceive it ourselves
+    const AActor* Target = CurrentTargetActor.Get();
+    bTargetPerceived = Target && PerceivedHostiles.ContainsByPredicate([Target](const TWeakObjectPtr<ASolaraqShipBase>& Ship) { return Ship.Get() == Target; });
+    if (!bTargetPerceived)
+    {
+        bHasLineOfSight = false;
+    }
 }
 
 void ASolaraqAIController::Tick(float DeltaTime)
 {
+    SolaraqBenchmark::FScopedAITimer BenchmarkTimer; // Feeds the AI column of the benchmark report
     Super::Tick(DeltaTime);
 
     // --- Initial Check & State Log ---
@@ -205,6 +346,7 @@ void ASolaraqAIController::Tick(float DeltaTime)
             UE_LOG(LogSolaraqAI, Warning, TEXT("%s Tick: Controlled Ship Invalid/Dead. Clearing state."), *GetName());
             CurrentTargetActor = nullptr;
             bHasLineOfSight = false;
+            bTargetPerceived = false;
             bIsPerformingBoostTurn = false;
             if (ControlledEnemyShip && ControlledEnemyShip->IsBoosting())
             {
@@ -215,12 +357,36 @@ void ASolaraqAIController::Tick(float DeltaTime)
         return;
     }
 
+    // --- Formation followers only fly their slot until the formation breaks ---
+    if (IsFollowingFormation())
+    {
+        ExecuteFormationMovement(DeltaTime);
+        return;
+    }
+
     // --- Get Current State Info ---
     AActor* Target = CurrentTargetActor.Get(); // Get valid pointer if weak ptr is valid
     const FVector ShipLocation = ControlledEnemyShip->GetActorLocation();
     const FVector ShipForward = ControlledEnemyShip->GetActorForwardVector();
     const FVector ShipVelocity = ControlledEnemyShip->GetCollisionAndPhysicsRoot() ? ControlledEnemyShip->GetCollisionAndPhysicsRoot()->GetPhysicsLinearVelocity() : FVector::ZeroVector;
 
+    // --- Line of Sight (cached, batched async traces; result lags one frame at most) ---
+    USolaraqLineOfSightSubsystem* LineOfSight = USolaraqLineOfSightSubsystem::Get(this);
+    if (Target && bTargetPerceived && LineOfSight)
+    {
+        const ESolaraqLineOfSight Sight = LineOfSight->QueryLineOfSight(ControlledEnemyShip, Target, ShipLocation, Target->GetActorLocation());
+        bHasLineOfSight = Sight != ESolaraqLineOfSight::Blocked;
+        if (bHasLineOfSight)
+        {
+            // Remember where it was last seen, the search branch turns towards this once it ducks behind a rock
+            LastKnownTargetLocation = Target->GetActorLocation();
+        }
+    }
+    else
+    {
+        bHasLineOfSight = bTargetPerceived;
+    }
+
     // --- High-Visibility Log: State at Start of Tick ---
     UE_LOG(LogSolaraqAI, Log, TEXT("%s TICK CHECK ----> Target: [%s], HasLoS: [%d], BoostTurning: [%d]"),
            *GetName(),
@@ -294,7 +460,14 @@ void ASolaraqAIController::Tick(float DeltaTime)
                  float AimDotProduct = FVector::DotProduct(ShipForward, DirectionToAim);
                  if (AimDotProduct > 0.98f)
                  {
-                     ControlledEnemyShip->FireWeapon();
+                     // Don't waste projectiles on asteroids/planets between us and the aim point
+                     const ESolaraqLineOfSight ShotLane = LineOfSight
+                         ? LineOfSight->QueryLineOfSight(ControlledEnemyShip, Target, ControlledEnemyShip->GetMuzzleLocation(), PredictedAimLocation, ESolaraqLineOfSightQuery::ShotLane)
+                         : ESolaraqLineOfSight::Clear;
+                     if (ShotLane == ESolaraqLineOfSight::Clear)
+                     {
+                         ControlledEnemyShip->FireWeapon();
+                     }
                  }
              }
          }
@@ -313,8 +486,15 @@ void ASolaraqAIController::Tick(float DeltaTime)
     }
     else // No Target
     {
-         UE_LOG(LogSolaraqAI, Log, TEXT("%s Tick State: === IDLE ==="), *GetName());
-        ExecuteIdleMovement();
+        if (bHasMoveDestination)
+        {
+            ExecuteTravelMovement(DeltaTime);
+        }
+        else
+        {
+             UE_LOG(LogSolaraqAI, Log, TEXT("%s Tick State: === IDLE ==="), *GetName());
+            ExecuteIdleMovement();
+        }
         bIsPerformingBoostTurn = false;
          // Reset dogfight state if no target
         CurrentDogfightState = EDogfightState::OffsetApproach;
@@ -327,12 +507,35 @@ void ASolaraqAIController::HandlePerceptionUpdated(const TArray<AActor*>& Update
 {
     //UE_LOG(LogSolaraqAI, Warning, TEXT("%s Perception Updated. %d actors reported."), *GetName(), UpdatedActors.Num());
 
+    // Followers leave target search to the leader; they refresh from perception when the formation breaks
+    if (IsFollowingFormation())
+    {
+        return;
+    }
+
+    RefreshTargetFromPerception();
+}
+
+void ASolaraqAIController::RefreshTargetFromPerception()
+{
+    if (!PerceptionComponent)
+    {
+        return;
+    }
+
     TArray<AActor*> PerceivedActors;
     PerceptionComponent->GetCurrentlyPerceivedActors(UAISense_Sight::StaticClass(), PerceivedActors);
 
     //UE_LOG(LogSolaraqAI, Warning, TEXT("Currently Perceived Actors (Sight): %d"), PerceivedActors.Num());
 
     UpdateTargetActor(PerceivedActors);
+
+    // Contact: the formation turns into a fight
+    if (bTargetPerceived && FormationFollowers.Num() > 0)
+    {
+        UE_LOG(LogSolaraqAI, Log, TEXT("%s Formation breaking, engaging %s."), *GetName(), *GetNameSafe(CurrentTargetActor.Get()));
+        BreakFormation();
+    }
 }
 
 // Example implementation using OnTargetPerceptionUpdated instead:
@@ -376,6 +579,14 @@ void ASolaraqAIController::UpdateTargetActor(const TArray<AActor*>& PerceivedAct
 {
     AActor* BestTarget = nullptr;
     float BestTargetDistSq = FLT_MAX; // Use FLT_MAX from limits.h or float limits
+    USolaraqLineOfSightSubsystem* LineOfSight = USolaraqLineOfSightSubsystem::Get(this);
+    const USolaraqThreatMapSubsystem* ThreatMap = USolaraqThreatMapSubsystem::Get(this);
+    const USolaraqSquadSubsystem* Squads = USolaraqSquadSubsystem::Get(this);
+    const float TargetAreaDangerWeight = Squads ? Squads->GetTargetAreaDangerWeight() : 0.0f; // Target distance is scaled by (1 + weight * threat around the target)
+    PerceivedHostiles.Reset();
+
+    // Under squad orders the squad picks the target: we only report what we see, no scoring or LoS traces of our own
+    const bool bFollowingSquadOrders = bHasSquadOrders && CurrentTargetActor.IsValid();
 
     //UE_LOG(LogSolaraqAI, Warning, TEXT("UpdateTargetActor: Checking %d perceived actors."), PerceivedActors.Num()); // <<< ADDED LOG
 
@@ -395,8 +606,29 @@ void ASolaraqAIController::UpdateTargetActor(const TArray<AActor*>& PerceivedAct
             if (PerceivedShip && PerceivedShip != ControlledEnemyShip && !PerceivedShip->IsDead())
             {
                  //UE_LOG(LogSolaraqAI, Warning, TEXT("  -> Actor %s is a valid Hostile Ship."), *PerceivedActor->GetName()); // <<< ADDED LOG
+                if (bFollowingSquadOrders)
+                {
+                    PerceivedHostiles.Add(PerceivedShip);
+                    continue;
+                }
+
                 float DistSq = FVector::DistSquared(ControlledEnemyShip->GetActorLocation(), PerceivedShip->GetActorLocation());
-                if (DistSq < BestTargetDistSq)
+                // Prefer targets that aren't sitting under their friends' guns
+                if (ThreatMap)
+                {
+                    DistSq *= 1.0f + TargetAreaDangerWeight * ThreatMap->GetThreat(GetGenericTeamId(), PerceivedShip->GetActorLocation());
+                }
+
+                // Skip ships hidden behind obstacles (Unknown = not traced yet, give it the benefit of the doubt)
+                const bool bBlocked = LineOfSight && LineOfSight->QueryLineOfSight(ControlledEnemyShip, PerceivedShip,
+                    ControlledEnemyShip->GetActorLocation(), PerceivedShip->GetActorLocation()) == ESolaraqLineOfSight::Blocked;
+
+                if (!bBlocked)
+                {
+                    PerceivedHostiles.Add(PerceivedShip);
+                }
+
+                if (!bBlocked && DistSq < BestTargetDistSq)
                 {
                     BestTargetDistSq = DistSq;
                     BestTarget = PerceivedActor;
@@ -412,6 +644,12 @@ void ASolaraqAIController::UpdateTargetActor(const TArray<AActor*>& PerceivedAct
          else { UE_LOG(LogSolaraqAI, Warning, TEXT("  -> Actor %s is not Hostile."), *PerceivedActor->GetName()); } // <<< ADDED LOG
     }
 
+    // --- Squad orders take precedence (the squad picked from everything its members perceive) ---
+    if (bFollowingSquadOrders)
+    {
+        return;
+    }
+
     // --- Update State based on BestTarget found ---
     if (BestTarget)
     {
@@ -422,6 +660,7 @@ void ASolaraqAIController::UpdateTargetActor(const TArray<AActor*>& PerceivedAct
             PredictedAimLocation = BestTarget->GetActorLocation();
         }
         LastKnownTargetLocation = BestTarget->GetActorLocation();
+        bTargetPerceived = true;
         bHasLineOfSight = true;
          UE_LOG(LogSolaraqAI, Warning, TEXT("%s Target set to %s, HasLoS=true"), *GetName(), *BestTarget->GetName()); // <<< LOG FINAL STATE
     }
@@ -433,6 +672,7 @@ void ASolaraqAIController::UpdateTargetActor(const TArray<AActor*>& PerceivedAct
              UE_LOG(LogSolaraqAI, Warning, TEXT("%s LOST sight of target %s"), *GetName(), *CurrentTargetActor->GetName()); // <<< LOG TARGET LOSS
              // LastKnownTargetLocation already set
         }
+        bTargetPerceived = false;
         bHasLineOfSight = false;
         // Maybe clear target completely if LoS lost? Depends on desired behavior
         // CurrentTargetActor = nullptr;
@@ -453,6 +693,13 @@ void ASolaraqAIController::ExecuteChaseMovement(const FVector& TargetLocation, f
 {
     if (ControlledEnemyShip)
     {
+        // Route around planets when they're in the way; otherwise the direct chase is unchanged
+        FVector Waypoint;
+        if (GetNavWaypoint(TargetLocation, DeltaTime, Waypoint))
+        {
+            ControlledEnemyShip->TurnTowards(ApplyObstacleAvoidance(Waypoint));
+        }
+
         // Move full speed towards the target
         ControlledEnemyShip->RequestMoveForward(1.0f);
         // Turning is handled by the main Tick logic aiming at PredictedAimLocation
@@ -526,6 +773,8 @@ void ASolaraqAIController::ExecuteReversalTurnMovement(const FVector& TargetLoca
 
 void ASolaraqAIController::HandleOffsetApproach(AActor* Target, float DeltaTime)
 {
+    const FSolaraqDogfightTuning& Tuning = GetDogfightTuning();
+
     // --- Initial Checks ---
     // Ensure the controlled ship and the target are valid.
     if (!ControlledEnemyShip || !Target)
@@ -552,7 +801,7 @@ void ASolaraqAIController::HandleOffsetApproach(AActor* Target, float DeltaTime)
 
         // Define how long the boost should last during this approach phase.
         // Example: Boost for half the total approach duration. Tune this value.
-        const float BoostDuration = OffsetApproachDuration * 0.5f;
+        const float BoostDuration = Tuning.OffsetApproachDuration * 0.5f;
 
         // Check if the boost duration has elapsed.
         if (TimeInCurrentDogfightState > BoostDuration)
@@ -576,8 +825,8 @@ void ASolaraqAIController::HandleOffsetApproach(AActor* Target, float DeltaTime)
     // This prevents flipping the offset side mid-approach.
     if (TimeInCurrentDogfightState <= DeltaTime) // First frame check
     {
-        // Randomly choose -1 (left) or 1 (right).
-        CurrentOffsetSide = (FMath::RandBool()) ? 1 : -1;
+        // Squad members sharing a target get alternating sides; solo ships randomly choose -1 (left) or 1 (right).
+        CurrentOffsetSide = bHasSquadOrders ? SquadOffsetSide : ((FMath::RandBool()) ? 1 : -1);
         UE_LOG(LogSolaraqAI, Log, TEXT("%s Dogfight: Entering OffsetApproach, OffsetSide = %d"), *GetName(), CurrentOffsetSide);
     }
 
@@ -594,7 +843,9 @@ void ASolaraqAIController::HandleOffsetApproach(AActor* Target, float DeltaTime)
 
     // Calculate the actual world-space point the AI should move towards.
     // This point is offset from the target's current location.
-    CurrentMovementTargetPoint = TargetLocation + (OffsetDirection * DogfightOffsetDistance);
+    CurrentMovementTargetPoint = TargetLocation + (OffsetDirection * Tuning.DogfightOffsetDistance);
+    // Steer around asteroids/planets on the way there
+    CurrentMovementTargetPoint = ApplyObstacleAvoidance(CurrentMovementTargetPoint);
 
     // --- Movement Execution ---
     // Turn the ship to face the calculated movement target point (the offset point).
@@ -607,7 +858,7 @@ void ASolaraqAIController::HandleOffsetApproach(AActor* Target, float DeltaTime)
 
     // --- State Transition Logic ---
     // Check if the allocated time for this approach phase has elapsed.
-    if (TimeInCurrentDogfightState >= OffsetApproachDuration)
+    if (TimeInCurrentDogfightState >= Tuning.OffsetApproachDuration)
     {
         // Before transitioning, ensure the boost is turned off if the flag was somehow still active
         // (e.g., if OffsetApproachDuration was shorter than the calculated BoostDuration).
@@ -629,6 +880,8 @@ void ASolaraqAIController::HandleOffsetApproach(AActor* Target, float DeltaTime)
 
 void ASolaraqAIController::HandleEngage(AActor* Target, float DeltaTime)
 {
+    const FSolaraqDogfightTuning& Tuning = GetDogfightTuning();
+
     // --- Initial Checks ---
     if (!ControlledEnemyShip || !Target || !ControlledEnemyShip->GetCollisionAndPhysicsRoot())
     {
@@ -645,14 +898,14 @@ void ASolaraqAIController::HandleEngage(AActor* Target, float DeltaTime)
 
     // --- Movement ---
     // Apply PARTIAL forward thrust consistently to maintain speed
-    ControlledEnemyShip->RequestMoveForward(EngageForwardThrustScale); // Use the new parameter
+    ControlledEnemyShip->RequestMoveForward(Tuning.EngageForwardThrustScale); // Use the new parameter
 
     // Aiming (TurnTowards) is handled by the main Tick loop's common logic block
     // based on PredictedAimLocation when bShouldAimAndFire is true.
     // Firing is also handled by the main Tick loop.
 
     UE_LOG(LogSolaraqAI, Log, TEXT("%s Dogfight: Engage - Thrust Scale: %.2f, Speed: %.0f, Aiming/Firing Enabled"),
-        *GetName(), EngageForwardThrustScale, CurrentSpeed);
+        *GetName(), Tuning.EngageForwardThrustScale, CurrentSpeed);
 
     // --- State Transition Logic ---
     bool bTransitionState = false;
@@ -675,11 +928,11 @@ void ASolaraqAIController::HandleEngage(AActor* Target, float DeltaTime)
         UE_LOG(LogSolaraqAI, Verbose, TEXT("%s Dogfight: Engage - Angle Check: VelDir vs TargetDir = %.1f deg"), *GetName(), AngleDeg);
 
         // Use the same threshold name 'DriftAimAngleThreshold' or rename it to 'EngageAngleThreshold'
-        if (AngleDeg > DriftAimAngleThreshold)
+        if (AngleDeg > Tuning.DriftAimAngleThreshold)
         {
             bTransitionState = true;
             NextState = EDogfightState::Reposition; // Bad angle triggers reposition
-            TransitionReason = FString::Printf(TEXT("Engage Angle Too Wide (%.1f > %.1f)"), AngleDeg, DriftAimAngleThreshold);
+            TransitionReason = FString::Printf(TEXT("Engage Angle Too Wide (%.1f > %.1f)"), AngleDeg, Tuning.DriftAimAngleThreshold);
         }
     }
     // Reason 2 (Optional Failsafe): Speed *still* dropped too low despite thrust?
@@ -703,6 +956,8 @@ void ASolaraqAIController::HandleEngage(AActor* Target, float DeltaTime)
 
 void ASolaraqAIController::HandleReposition(AActor* Target, float DeltaTime)
 {
+    const FSolaraqDogfightTuning& Tuning = GetDogfightTuning();
+
     if (!ControlledEnemyShip || !Target) return;
 
     const FVector ShipLocation = ControlledEnemyShip->GetActorLocation();
@@ -715,8 +970,21 @@ void ASolaraqAIController::HandleReposition(AActor* Target, float DeltaTime)
         DirectionAway = ControlledEnemyShip->GetActorForwardVector() * -1.0f; // Move backwards
     }
 
+    // Bend the escape toward lower threat (away from enemy groups and gravity wells), never back toward the target
+    if (const USolaraqThreatMapSubsystem* ThreatMap = USolaraqThreatMapSubsystem::Get(this))
+    {
+        const FVector RetreatDirection = ThreatMap->GetRetreatDirection(GetGenericTeamId(), ShipLocation);
+        const FVector Blended = (DirectionAway + RetreatDirection * Tuning.RepositionThreatWeight).GetSafeNormal();
+        if ((Blended | DirectionAway) > 0.0f)
+        {
+            DirectionAway = Blended;
+        }
+    }
+
     // Calculate the point to move towards
-    CurrentMovementTargetPoint = ShipLocation + (DirectionAway * RepositionDistance); // Move RepositionDistance units away
+    CurrentMovementTargetPoint = ShipLocation + (DirectionAway * Tuning.RepositionDistance); // Move RepositionDistance units away
+    // Don't reposition straight into a rock
+    CurrentMovementTargetPoint = ApplyObstacleAvoidance(CurrentMovementTargetPoint);
 
 
     // --- Movement ---
@@ -729,7 +997,7 @@ void ASolaraqAIController::HandleReposition(AActor* Target, float DeltaTime)
 
 
     // --- State Transition ---
-    if (TimeInCurrentDogfightState >= RepositionDuration)
+    if (TimeInCurrentDogfightState >= Tuning.RepositionDuration)
     {
         UE_LOG(LogSolaraqAI, Warning, TEXT("%s Dogfight: Transition -> OffsetApproach (Reposition Duration Ended). Requesting Boost."), *GetName());
         CurrentDogfightState = EDogfightState::OffsetApproach;
@@ -757,3 +1025,192 @@ float ASolaraqAIController::GetAngleToTarget(const FVector& TargetLocation) cons
     float AngleRad = FMath::Acos(Dot);
     return FMath::RadiansToDegrees(AngleRad);
 }
+
+FVector ASolaraqAIController::ApplyObstacleAvoidance(const FVector& DesiredPoint) const
+{
+    const USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this);
+    if (!ObstacleField || !ControlledEnemyShip || ObstacleAvoidanceWeight <= 0.0f) return DesiredPoint;
+
+    const FVector ShipLocation = ControlledEnemyShip->GetActorLocation();
+    const FVector ShipVelocity = ControlledEnemyShip->GetVelocity();
+
+    // Sample where we'll be shortly, not where we are (we can't dodge what we're already touching)
+    const FVector Avoidance = ObstacleField->SampleAvoidance(ShipLocation + ShipVelocity * ObstacleLookAheadTime);
+    if (Avoidance.IsNearlyZero()) return DesiredPoint;
+
+    const FVector ToDesired = DesiredPoint - ShipLocation;
+    const float DesiredDistance = ToDesired.Size();
+    const FVector SteerDirection = (ToDesired.GetSafeNormal() + Avoidance * ObstacleAvoidanceWeight).GetSafeNormal();
+    if (SteerDirection.IsNearlyZero()) return DesiredPoint;
+
+    UE_LOG(LogSolaraqAI, Verbose, TEXT("%s Avoidance: Strength %.2f, bending movement target."), *GetName(), Avoidance.Size());
+    return ShipLocation + SteerDirection * DesiredDistance;
+}
+
+bool ASolaraqAIController::GetNavWaypoint(const FVector& Destination, float DeltaTime, FVector& OutWaypoint)
+{
+    USolaraqNavGraphSubsystem* NavGraph = USolaraqNavGraphSubsystem::Get(this);
+    if (!NavGraph || !ControlledEnemyShip)
+    {
+        return false;
+    }
+
+    const FVector ShipLocation = ControlledEnemyShip->GetActorLocation();
+
+    // --- Refresh the route when it's old, the graph changed or the destination wandered off ---
+    NavRepathTimer -= DeltaTime;
+    if (NavRepathTimer <= 0.0f ||
+        NavPathGraphVersion != NavGraph->GetGraphVersion() ||
+        FVector::DistSquared(NavPathDestination, Destination) > FMath::Square(NavRepathDistance))
+    {
+        CurrentNavPath = NavGraph->FindPath(ShipLocation, Destination);
+        NavWaypointIndex = 0;
+        NavPathDestination = Destination;
+        NavPathGraphVersion = NavGraph->GetGraphVersion();
+        NavRepathTimer = NavRepathInterval;
+    }
+
+    if (!CurrentNavPath.IsValid())
+    {
+        return false;
+    }
+
+    // --- Skip waypoints we've already reached ---
+    const TArray<FVector>& Waypoints = CurrentNavPath->Waypoints;
+    while (NavWaypointIndex < Waypoints.Num() &&
+           FVector::DistSquared2D(ShipLocation, Waypoints[NavWaypointIndex]) < FMath::Square(NavWaypointAcceptRadius))
+    {
+        ++NavWaypointIndex;
+    }
+
+    if (NavWaypointIndex >= Waypoints.Num())
+    {
+        return false; // Direct path, or the last waypoint is behind us: fly straight at the destination
+    }
+
+    OutWaypoint = Waypoints[NavWaypointIndex];
+    return true;
+}
+
+// --- Formation ---
+
+FVector ASolaraqAIController::ComputeFormationSlotOffset(int32 SlotIndex) const
+{
+    const int32 Row = SlotIndex / 2 + 1;
+    const float Side = (SlotIndex % 2 == 0) ? 1.0f : -1.0f; // Alternate right/left
+
+    switch (FormationShape)
+    {
+    case ESolaraqFormationShape::Line:
+        return FVector(0.0f, Side * Row * FormationSpacing, 0.0f);
+    case ESolaraqFormationShape::Column:
+        return FVector(-(SlotIndex + 1) * FormationSpacing, 0.0f, 0.0f);
+    case ESolaraqFormationShape::Wedge:
+    default:
+        return FVector(-Row * FormationSpacing, Side * Row * FormationSpacing, 0.0f);
+    }
+}
+
+void ASolaraqAIController::AddFormationFollower(ASolaraqAIController* Follower)
+{
+    if (!Follower || Follower == this || IsFollowingFormation())
+    {
+        return; // No nested formations
+    }
+
+    Follower->BreakFormation();
+    FormationFollowers.RemoveAll([](const TWeakObjectPtr<ASolaraqAIController>& Ptr) { return !Ptr.IsValid(); });
+
+    // Lowest slot nobody holds, so a joiner fills the gap a departed follower left instead of stacking on someone
+    int32 SlotIndex = 0;
+    while (FormationFollowers.ContainsByPredicate([SlotIndex](const TWeakObjectPtr<ASolaraqAIController>& Ptr) { return Ptr->FormationSlotIndex == SlotIndex; }))
+    {
+        ++SlotIndex;
+    }
+
+    Follower->FormationLeader = this;
+    Follower->FormationSlotIndex = SlotIndex;
+    Follower->FormationSlotOffset = ComputeFormationSlotOffset(SlotIndex);
+    Follower->CurrentTargetActor = nullptr;
+    Follower->bTargetPerceived = false;
+    Follower->bHasLineOfSight = false;
+    FormationFollowers.Add(Follower);
+
+    UE_LOG(LogSolaraqAI, Log, TEXT("%s joined %s's formation (slot %d, %s)."), *Follower->GetName(), *GetName(), SlotIndex, *Follower->FormationSlotOffset.ToString());
+}
+
+void ASolaraqAIController::BreakFormation()
+{
+    // Leader side: release everyone
+    TArray<TWeakObjectPtr<ASolaraqAIController>> Followers = MoveTemp(FormationFollowers);
+    FormationFollowers.Reset();
+    for (const TWeakObjectPtr<ASolaraqAIController>& FollowerPtr : Followers)
+    {
+        if (ASolaraqAIController* Follower = FollowerPtr.Get())
+        {
+            Follower->FormationLeader = nullptr;
+            Follower->FormationSlotIndex = INDEX_NONE;
+            Follower->RefreshTargetFromPerception(); // Perception events may not re-fire for things already seen
+        }
+    }
+
+    // Follower side: leave, the slot stays empty until the next joiner (other followers keep their offsets)
+    if (ASolaraqAIController* Leader = FormationLeader.Get())
+    {
+        Leader->FormationFollowers.Remove(this);
+        FormationLeader = nullptr;
+        FormationSlotIndex = INDEX_NONE;
+        RefreshTargetFromPerception();
+    }
+}
+
+void ASolaraqAIController::SetMoveDestination(const FVector& Destination)
+{
+    MoveDestination = Destination;
+    bHasMoveDestination = true;
+}
+
+void ASolaraqAIController::ExecuteFormationMovement(float DeltaTime)
+{
+    const ASolaraqAIController* Leader = FormationLeader.Get();
+    const APawn* LeaderPawn = Leader ? Leader->GetPawn() : nullptr;
+    const ASolaraqShipBase* LeaderShip = Cast<ASolaraqShipBase>(LeaderPawn);
+
+    // A dead leader keeps its pawn until the wreck is destroyed; don't fly formation around it
+    if (!LeaderPawn || (LeaderShip && LeaderShip->IsDead()))
+    {
+        BreakFormation();
+        return;
+    }
+
+    // Slot in world space (yaw only, the play plane is flat)
+    const FRotator LeaderYaw(0.0f, LeaderPawn->GetActorRotation().Yaw, 0.0f);
+    const FVector LeaderVelocity = LeaderPawn->GetVelocity();
+    const FVector SlotLocation = LeaderPawn->GetActorLocation() + LeaderYaw.RotateVector(FormationSlotOffset);
+
+    // Steer at the slot projected ahead so we match the leader's heading instead of orbiting the slot
+    ControlledEnemyShip->TurnTowards(SlotLocation + LeaderVelocity * FormationLeadTime);
+
+    // Throttle by how far the slot is ahead of our nose
+    const float DistanceAhead = FVector::DotProduct(SlotLocation - ControlledEnemyShip->GetActorLocation(), ControlledEnemyShip->GetActorForwardVector());
+    ControlledEnemyShip->RequestMoveForward(FMath::Clamp(DistanceAhead / FormationCatchUpDistance, 0.0f, 1.0f));
+}
+
+void ASolaraqAIController::ExecuteTravelMovement(float DeltaTime)
+{
+    const FVector ShipLocation = ControlledEnemyShip->GetActorLocation();
+    if (FVector::DistSquared2D(ShipLocation, MoveDestination) < FMath::Square(NavWaypointAcceptRadius))
+    {
+        UE_LOG(LogSolaraqAI, Log, TEXT("%s Reached move destination."), *GetName());
+        bHasMoveDestination = false;
+        ExecuteIdleMovement();
+        return;
+    }
+
+    FVector SteerPoint = MoveDestination;
+    GetNavWaypoint(MoveDestination, DeltaTime, SteerPoint);
+    ControlledEnemyShip->TurnTowards(ApplyObstacleAvoidance(SteerPoint));
+
+    // Hold back a little while leading, so followers can keep their slots
+    ControlledEnemyShip->RequestMoveForward(FormationFollowers.Num() > 0 ? FormationLeaderThrust : 1.0f);
+}
@@ -0,0 +1,398 @@
+// SolaraqAbstractCombatSubsystem.cpp
+
+#include "AI/SolaraqAbstractCombatSubsystem.h"
+#include "AI/SolaraqAIController.h"
+#include "Pawns/SolaraqEnemyShip.h"
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqAbstractCombatSubsystem* USolaraqAbstractCombatSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqAbstractCombatSubsystem>() : nullptr;
+}
+
+bool USolaraqAbstractCombatSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqAbstractCombatSubsystem::Deinitialize()
+{
+    Records.Empty();
+    Super::Deinitialize();
+}
+
+TStatId USolaraqAbstractCombatSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqAbstractCombatSubsystem, STATGROUP_Tickables);
+}
+
+int32 USolaraqAbstractCombatSubsystem::GetNumAbstractShips() const
+{
+    int32 Count = 0;
+    for (const FCombatRecord& Record : Records)
+    {
+        Count += Record.Ships.Num();
+    }
+    return Count;
+}
+
+void USolaraqAbstractCombatSubsystem::SetEnabled(bool bInEnabled)
+{
+    if (bEnabled == bInEnabled)
+    {
+        return;
+    }
+    bEnabled = bInEnabled;
+
+    if (!bEnabled)
+    {
+        for (const FCombatRecord& Record : Records)
+        {
+            RehydrateRecord(Record);
+        }
+        Records.Empty();
+    }
+}
+
+void USolaraqAbstractCombatSubsystem::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!bEnabled || !World || World->GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    // --- Damage model ---
+    TimeUntilResolve -= DeltaTime;
+    if (TimeUntilResolve <= 0.0f)
+    {
+        TimeUntilResolve += ResolveInterval;
+        for (FCombatRecord& Record : Records)
+        {
+            if (!Record.bResolved)
+            {
+                ResolveRecord(Record, ResolveInterval);
+            }
+        }
+        // Wiped-out engagements leave nothing to rehydrate
+        Records.RemoveAllSwap([](const FCombatRecord& Record) { return Record.Ships.Num() == 0; });
+    }
+
+    // --- Collapse / rehydrate against player positions ---
+    TimeUntilEvaluate -= DeltaTime;
+    if (TimeUntilEvaluate > 0.0f)
+    {
+        return;
+    }
+    TimeUntilEvaluate = EvaluateInterval;
+
+    TArray<FVector> PlayerLocations;
+    GatherPlayerLocations(PlayerLocations);
+
+    for (int32 Index = Records.Num() - 1; Index >= 0; --Index)
+    {
+        if (IsAnyPlayerNear(PlayerLocations, Records[Index].Center, Records[Index].Radius + RehydrateDistance))
+        {
+            RehydrateRecord(Records[Index]);
+            Records.RemoveAtSwap(Index);
+        }
+    }
+
+    CollapseEngagements(PlayerLocations);
+}
+
+void USolaraqAbstractCombatSubsystem::GatherPlayerLocations(TArray<FVector>& OutLocations) const
+{
+    for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (!PlayerController)
+        {
+            continue;
+        }
+        if (const APawn* Pawn = PlayerController->GetPawn())
+        {
+            OutLocations.Add(Pawn->GetActorLocation());
+        }
+        else
+        {
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+            OutLocations.Add(ViewLocation);
+        }
+    }
+}
+
+bool USolaraqAbstractCombatSubsystem::IsAnyPlayerNear(const TArray<FVector>& PlayerLocations, const FVector& Center, float Distance) const
+{
+    const float DistanceSq = FMath::Square(Distance);
+    for (const FVector& PlayerLocation : PlayerLocations)
+    {
+        if (FVector::DistSquared2D(PlayerLocation, Center) <= DistanceSq)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool USolaraqAbstractCombatSubsystem::HasHostilePair(const TArray<FGenericTeamId, TInlineAllocator<4>>& Teams) const
+{
+    const USolaraqTeamSubsystem* TeamSubsystem = USolaraqTeamSubsystem::Get(this);
+    for (int32 A = 0; A < Teams.Num(); ++A)
+    {
+        for (int32 B = A + 1; B < Teams.Num(); ++B)
+        {
+            const ETeamAttitude::Type Attitude = TeamSubsystem
+                ? TeamSubsystem->GetAttitude(Teams[A], Teams[B])
+                : (Teams[A] != Teams[B] ? ETeamAttitude::Hostile : ETeamAttitude::Friendly);
+            if (Attitude == ETeamAttitude::Hostile)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// --- Collapse ---
+
+void USolaraqAbstractCombatSubsystem::CollapseEngagements(const TArray<FVector>& PlayerLocations)
+{
+    // --- Candidate ships: alive, AI driven, nobody watching closely enough to matter yet ---
+    TArray<ASolaraqEnemyShip*> Ships;
+    for (TActorIterator<ASolaraqEnemyShip> It(GetWorld()); It; ++It)
+    {
+        ASolaraqEnemyShip* Ship = *It;
+        if (Ship->HasActorBegunPlay() && !Ship->IsDead() && !Ship->IsPlayerControlled() && Cast<ASolaraqAIController>(Ship->GetController()))
+        {
+            Ships.Add(Ship);
+        }
+    }
+    if (Ships.Num() < 2)
+    {
+        return;
+    }
+
+    // --- Cluster by proximity: grid buckets + union-find ---
+    TArray<int32> Parent;
+    Parent.SetNumUninitialized(Ships.Num());
+    for (int32 Index = 0; Index < Ships.Num(); ++Index)
+    {
+        Parent[Index] = Index;
+    }
+    const auto FindRoot = [&Parent](int32 Index)
+    {
+        while (Parent[Index] != Index)
+        {
+            Parent[Index] = Parent[Parent[Index]];
+            Index = Parent[Index];
+        }
+        return Index;
+    };
+
+    TMap<FIntPoint, TArray<int32, TInlineAllocator<4>>> Cells;
+    const auto GetCell = [this](const FVector& Location)
+    {
+        return FIntPoint(FMath::FloorToInt32(Location.X / EngagementRadius), FMath::FloorToInt32(Location.Y / EngagementRadius));
+    };
+    for (int32 Index = 0; Index < Ships.Num(); ++Index)
+    {
+        Cells.FindOrAdd(GetCell(Ships[Index]->GetActorLocation())).Add(Index);
+    }
+
+    const float EngagementRadiusSq = FMath::Square(EngagementRadius);
+    for (int32 Index = 0; Index < Ships.Num(); ++Index)
+    {
+        const FVector Location = Ships[Index]->GetActorLocation();
+        const FIntPoint Cell = GetCell(Location);
+        for (int32 X = Cell.X - 1; X <= Cell.X + 1; ++X)
+        {
+            for (int32 Y = Cell.Y - 1; Y <= Cell.Y + 1; ++Y)
+            {
+                const auto* Bucket = Cells.Find(FIntPoint(X, Y));
+                if (!Bucket)
+                {
+                    continue;
+                }
+                for (const int32 Other : *Bucket)
+                {
+                    if (Other > Index && FVector::DistSquared2D(Location, Ships[Other]->GetActorLocation()) <= EngagementRadiusSq)
+                    {
+                        Parent[FindRoot(Other)] = FindRoot(Index);
+                    }
+                }
+            }
+        }
+    }
+
+    TMap<int32, TArray<ASolaraqEnemyShip*>> Clusters;
+    for (int32 Index = 0; Index < Ships.Num(); ++Index)
+    {
+        Clusters.FindOrAdd(FindRoot(Index)).Add(Ships[Index]);
+    }
+
+    // --- Collapse unobserved engagements ---
+    for (const auto& Pair : Clusters)
+    {
+        const TArray<ASolaraqEnemyShip*>& Cluster = Pair.Value;
+        if (Cluster.Num() < 2)
+        {
+            continue;
+        }
+
+        TArray<FGenericTeamId, TInlineAllocator<4>> Teams;
+        FBox Bounds(ForceInit);
+        for (const ASolaraqEnemyShip* Ship : Cluster)
+        {
+            Teams.AddUnique(Ship->GetGenericTeamId());
+            Bounds += Ship->GetActorLocation();
+        }
+        if (!HasHostilePair(Teams))
+        {
+            continue; // A patrol, not a fight
+        }
+
+        if (!IsAnyPlayerNear(PlayerLocations, Bounds.GetCenter(), Bounds.GetExtent().Size2D() + CollapseDistance))
+        {
+            CollapseShips(Cluster);
+        }
+    }
+}
+
+void USolaraqAbstractCombatSubsystem::CollapseShips(const TArray<ASolaraqEnemyShip*>& Ships)
+{
+    FCombatRecord& Record = Records.AddDefaulted_GetRef();
+
+    FBox Bounds(ForceInit);
+    for (const ASolaraqEnemyShip* Ship : Ships)
+    {
+        Bounds += Ship->GetActorLocation();
+    }
+    Record.Center = Bounds.GetCenter();
+    Record.Radius = Bounds.GetExtent().Size2D();
+
+    for (ASolaraqEnemyShip* Ship : Ships)
+    {
+        AController* Controller = Ship->GetController();
+
+        FAbstractShip& Entry = Record.Ships.AddDefaulted_GetRef();
+        Entry.ShipClass = Ship->GetClass();
+        Entry.ControllerClass = Controller ? Controller->GetClass() : ASolaraqAIController::StaticClass();
+        Entry.TeamId = Ship->GetGenericTeamId();
+        Entry.Health = Ship->GetCurrentHealth();
+        Entry.DamagePerSecond = Ship->GetWeaponDamagePerSecond();
+        Entry.Offset = Ship->GetActorLocation() - Record.Center;
+        Entry.Rotation = Ship->GetActorRotation();
+
+        if (Controller)
+        {
+            Controller->Destroy();
+        }
+        Ship->Destroy();
+    }
+
+    UE_LOG(LogSolaraqAI, Log, TEXT("AbstractCombat: Collapsed engagement of %d ships at %s (%d records)."),
+        Record.Ships.Num(), *Record.Center.ToString(), Records.Num());
+}
+
+// --- Resolve ---
+
+void USolaraqAbstractCombatSubsystem::ResolveRecord(FCombatRecord& Record, float DeltaTime)
+{
+    const USolaraqTeamSubsystem* TeamSubsystem = USolaraqTeamSubsystem::Get(this);
+    const auto IsHostile = [TeamSubsystem](FGenericTeamId A, FGenericTeamId B)
+    {
+        return TeamSubsystem ? TeamSubsystem->GetAttitude(A, B) == ETeamAttitude::Hostile : A != B;
+    };
+
+    // --- Pick targets first so every ship fires "simultaneously" ---
+    TArray<float, TInlineAllocator<16>> PendingDamage;
+    PendingDamage.Init(0.0f, Record.Ships.Num());
+    bool bAnyHostilePair = false;
+
+    for (const FAbstractShip& Shooter : Record.Ships)
+    {
+        // Focus fire on the weakest hostile: quickest way to reduce the enemy's total DPS
+        int32 Target = INDEX_NONE;
+        for (int32 Index = 0; Index < Record.Ships.Num(); ++Index)
+        {
+            const FAbstractShip& Candidate = Record.Ships[Index];
+            if (IsHostile(Shooter.TeamId, Candidate.TeamId) && (Target == INDEX_NONE || Candidate.Health < Record.Ships[Target].Health))
+            {
+                Target = Index;
+            }
+        }
+        if (Target != INDEX_NONE)
+        {
+            bAnyHostilePair = true;
+            PendingDamage[Target] += Shooter.DamagePerSecond * AbstractHitRate * DeltaTime;
+        }
+    }
+
+    if (!bAnyHostilePair)
+    {
+        Record.bResolved = true;
+        UE_LOG(LogSolaraqAI, Log, TEXT("AbstractCombat: Engagement at %s resolved, %d survivors."), *Record.Center.ToString(), Record.Ships.Num());
+        return;
+    }
+
+    // --- Apply and remove the dead ---
+    for (int32 Index = Record.Ships.Num() - 1; Index >= 0; --Index)
+    {
+        Record.Ships[Index].Health -= PendingDamage[Index];
+        if (Record.Ships[Index].Health <= 0.0f)
+        {
+            UE_LOG(LogSolaraqAI, Verbose, TEXT("AbstractCombat: %s (Team %d) destroyed off-screen."),
+                *GetNameSafe(Record.Ships[Index].ShipClass.Get()), Record.Ships[Index].TeamId.GetId());
+            Record.Ships.RemoveAtSwap(Index);
+        }
+    }
+}
+
+// --- Rehydrate ---
+
+void USolaraqAbstractCombatSubsystem::RehydrateRecord(const FCombatRecord& Record)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    for (const FAbstractShip& Entry : Record.Ships)
+    {
+        if (!Entry.ShipClass)
+        {
+            continue;
+        }
+
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+        ASolaraqEnemyShip* Ship = World->SpawnActor<ASolaraqEnemyShip>(Entry.ShipClass, Record.Center + Entry.Offset, Entry.Rotation, SpawnParams);
+        if (!Ship)
+        {
+            UE_LOG(LogSolaraqAI, Error, TEXT("AbstractCombat: Failed to rehydrate %s."), *GetNameSafe(Entry.ShipClass.Get()));
+            continue;
+        }
+        Ship->SetGenericTeamId(Entry.TeamId);
+        Ship->RestoreHealth(Entry.Health);
+
+        // Same order as the benchmark spawner: team on the controller before possession refreshes the registry
+        UClass* ControllerClass = Entry.ControllerClass ? Entry.ControllerClass.Get() : ASolaraqAIController::StaticClass();
+        if (ASolaraqAIController* Controller = World->SpawnActor<ASolaraqAIController>(ControllerClass))
+        {
+            Controller->SetGenericTeamId(Entry.TeamId);
+            Controller->Possess(Ship);
+        }
+    }
+
+    UE_LOG(LogSolaraqAI, Log, TEXT("AbstractCombat: Rehydrated %d ships at %s."), Record.Ships.Num(), *Record.Center.ToString());
+}
@@ -0,0 +1,178 @@
+// SolaraqLineOfSightSubsystem.cpp
+
+#include "AI/SolaraqLineOfSightSubsystem.h"
+#include "Engine/World.h"
+#include "Gameplay/SolaraqCollisionChannels.h"
+#include "GameFramework/Actor.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqLineOfSightSubsystem* USolaraqLineOfSightSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqLineOfSightSubsystem>() : nullptr;
+}
+
+bool USolaraqLineOfSightSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqLineOfSightSubsystem::Deinitialize()
+{
+    Entries.Empty();
+    PendingQueue.Empty();
+    InFlight.Empty();
+    TraceDelegate.Unbind();
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqLineOfSightSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqLineOfSightSubsystem, STATGROUP_Tickables);
+}
+
+ESolaraqLineOfSight USolaraqLineOfSightSubsystem::QueryLineOfSight(const AActor* Shooter, const AActor* Target, const FVector& From, const FVector& To, ESolaraqLineOfSightQuery Kind)
+{
+    if (!Shooter || !Target)
+    {
+        return ESolaraqLineOfSight::Unknown;
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    FQueryKey Key;
+    Key.Shooter = Shooter;
+    Key.Target = Target;
+    Key.Kind = Kind;
+
+    FQueryEntry& Entry = Entries.FindOrAdd(Key);
+    Entry.From = From; // Always trace the latest endpoints
+    Entry.To = To;
+    Entry.LastRequestTime = Now;
+
+    const bool bStale = Entry.ResultTime < 0.0 || (Now - Entry.ResultTime) > CacheLifetime;
+    if (bStale && !Entry.bQueued && !Entry.bInFlight)
+    {
+        Entry.bQueued = true;
+        PendingQueue.Add(Key);
+    }
+
+    // Serve the last known answer while a refresh is pending
+    return Entry.Result;
+}
+
+void USolaraqLineOfSightSubsystem::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    if (!TraceDelegate.IsBound())
+    {
+        TraceDelegate.BindUObject(this, &USolaraqLineOfSightSubsystem::OnTraceCompleted);
+    }
+
+    const double Now = World->GetTimeSeconds();
+    ExpireLostTraces(Now);
+
+    // --- Issue this frame's batch ---
+    // By channel: object-type queries would also stop at trigger volumes (influence spheres are WorldDynamic)
+    const int32 NumToIssue = FMath::Min(MaxTracesPerFrame, PendingQueue.Num());
+    for (int32 Index = 0; Index < NumToIssue; ++Index)
+    {
+        const FQueryKey& Key = PendingQueue[Index];
+        FQueryEntry* Entry = Entries.Find(Key);
+        AActor* Shooter = Key.Shooter.ResolveObjectPtr();
+        AActor* Target = Key.Target.ResolveObjectPtr();
+        if (!Entry || !Shooter || !Target)
+        {
+            if (Entry) Entry->bQueued = false;
+            continue;
+        }
+
+        FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SolaraqAILineOfSight), false);
+        QueryParams.AddIgnoredActor(Shooter);
+        QueryParams.AddIgnoredActor(Target);
+
+        const uint32 RequestId = NextRequestId++;
+        const bool bShotLane = Key.Kind == ESolaraqLineOfSightQuery::ShotLane;
+        const ECollisionChannel Channel = bShotLane ? ECC_SolaraqProjectile : ECC_Visibility;
+        if (bShotLane && ShotLaneRadius > 0.0f)
+        {
+            World->AsyncSweepByChannel(EAsyncTraceType::Single, Entry->From, Entry->To, FQuat::Identity, Channel,
+                FCollisionShape::MakeSphere(ShotLaneRadius), QueryParams, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, RequestId);
+        }
+        else
+        {
+            World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Entry->From, Entry->To, Channel, QueryParams,
+                FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, RequestId);
+        }
+
+        Entry->bQueued = false;
+        Entry->bInFlight = true;
+        Entry->IssueTime = Now;
+        Entry->RequestId = RequestId;
+        InFlight.Add(RequestId, Key);
+    }
+    PendingQueue.RemoveAt(0, NumToIssue, EAllowShrinking::No);
+
+    // --- Occasional cleanup of pairs nobody asks about anymore ---
+    if (Now - LastPruneTime > 2.0)
+    {
+        PruneStaleEntries(Now);
+        LastPruneTime = Now;
+    }
+}
+
+void USolaraqLineOfSightSubsystem::OnTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceData)
+{
+    FQueryKey Key;
+    if (!InFlight.RemoveAndCopyValue(TraceData.UserData, Key))
+    {
+        return;
+    }
+
+    if (FQueryEntry* Entry = Entries.Find(Key))
+    {
+        const bool bBlocked = TraceData.OutHits.Num() > 0 && TraceData.OutHits[0].bBlockingHit;
+        Entry->Result = bBlocked ? ESolaraqLineOfSight::Blocked : ESolaraqLineOfSight::Clear;
+        Entry->ResultTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+        Entry->bInFlight = false;
+    }
+}
+
+void USolaraqLineOfSightSubsystem::ExpireLostTraces(double Now)
+{
+    for (auto It = InFlight.CreateIterator(); It; ++It)
+    {
+        FQueryEntry* Entry = Entries.Find(It.Value());
+        if (Entry && Entry->RequestId == It.Key() && (Now - Entry->IssueTime) <= InFlightTimeout)
+        {
+            continue;
+        }
+
+        // A late callback for a removed id is ignored by OnTraceCompleted
+        if (Entry && Entry->RequestId == It.Key())
+        {
+            UE_LOG(LogSolaraqAI, Verbose, TEXT("LineOfSight: trace %u timed out, re-queueing."), It.Key());
+            Entry->bInFlight = false;
+        }
+        It.RemoveCurrent();
+    }
+}
+
+void USolaraqLineOfSightSubsystem::PruneStaleEntries(double Now)
+{
+    const double MaxIdleTime = FMath::Max(1.0, CacheLifetime * 8.0);
+    for (auto It = Entries.CreateIterator(); It; ++It)
+    {
+        const FQueryEntry& Entry = It.Value();
+        if (!Entry.bQueued && !Entry.bInFlight && (Now - Entry.LastRequestTime) > MaxIdleTime)
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
@@ -0,0 +1,563 @@
+// SolaraqNavGraphSubsystem.cpp
+
+#include "AI/SolaraqNavGraphSubsystem.h"
+#include "Environment/CelestialBodyBase.h"
+#include "Environment/AsteroidFieldGenerator.h"
+#include "Components/DockingPadComponent.h"
+#include "Components/SplineComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Algo/Reverse.h"
+#include "Logging/SolaraqLogChannels.h"
+
+namespace
+{
+    FVector2D To2D(const FVector& Location)
+    {
+        return FVector2D(Location.X, Location.Y);
+    }
+
+    float PointSegmentDistSquared(const FVector2D& Point, const FVector2D& A, const FVector2D& B)
+    {
+        const FVector2D AB = B - A;
+        const float LengthSq = AB.SizeSquared();
+        const float T = LengthSq > KINDA_SMALL_NUMBER ? FMath::Clamp(FVector2D::DotProduct(Point - A, AB) / LengthSq, 0.0f, 1.0f) : 0.0f;
+        return FVector2D::DistSquared(Point, A + AB * T);
+    }
+
+    float SegmentSegmentDistSquared(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+    {
+        // Proper crossing -> distance 0
+        const float D1 = FVector2D::CrossProduct(B - A, C - A);
+        const float D2 = FVector2D::CrossProduct(B - A, D - A);
+        const float D3 = FVector2D::CrossProduct(D - C, A - C);
+        const float D4 = FVector2D::CrossProduct(D - C, B - C);
+        if (D1 * D2 < 0.0f && D3 * D4 < 0.0f)
+        {
+            return 0.0f;
+        }
+
+        return FMath::Min(
+            FMath::Min(PointSegmentDistSquared(A, C, D), PointSegmentDistSquared(B, C, D)),
+            FMath::Min(PointSegmentDistSquared(C, A, B), PointSegmentDistSquared(D, A, B)));
+    }
+
+    uint64 MakePathKey(int32 StartNode, int32 GoalNode)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(StartNode)) << 32) | static_cast<uint32>(GoalNode);
+    }
+}
+
+USolaraqNavGraphSubsystem* USolaraqNavGraphSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqNavGraphSubsystem>() : nullptr;
+}
+
+bool USolaraqNavGraphSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqNavGraphSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // AI only runs on the server
+    if (InWorld.GetNetMode() != NM_Client)
+    {
+        BuildGraph(InWorld);
+    }
+}
+
+void USolaraqNavGraphSubsystem::Deinitialize()
+{
+    NodeLocations.Empty();
+    Adjacency.Empty();
+    Obstacles.Empty();
+    Sources.Empty();
+    Candidates.Empty();
+    PathCache.Empty();
+    DirectPath.Reset();
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqNavGraphSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqNavGraphSubsystem, STATGROUP_Tickables);
+}
+
+// --- Build ---
+
+void USolaraqNavGraphSubsystem::BuildGraph(UWorld& World)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    AddCelestialSources(World);
+    AddAsteroidFieldSources(World);
+    AddDockingSources(World);
+
+    BuildAllCandidates();
+    RebuildAdjacency();
+
+    DirectPath = MakeShared<FSolaraqNavPath>();
+    PathCache.Empty();
+    ++GraphVersion;
+
+    UE_LOG(LogSolaraqAI, Log, TEXT("NavGraph: Built %d nodes, %d obstacles, %d candidate edges from %d sources in %.2f ms."),
+        NodeLocations.Num(), Obstacles.Num(), Candidates.Num(), Sources.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void USolaraqNavGraphSubsystem::AddCelestialSources(UWorld& World)
+{
+    for (TActorIterator<ACelestialBodyBase> It(&World); It; ++It)
+    {
+        const ACelestialBodyBase* Body = *It;
+        const float InfluenceDistance = Body->GetInfluenceDistance();
+        if (InfluenceDistance <= 0.0f)
+        {
+            continue;
+        }
+
+        FSource& Source = Sources.AddDefaulted_GetRef();
+        Source.Actor = Body;
+        Source.LastLocation = Body->GetActorLocation();
+        Source.FirstNode = NodeLocations.Num();
+        Source.FirstObstacle = Obstacles.Num();
+
+        // Ring of nodes just outside the influence sphere
+        const float RingRadius = InfluenceDistance * CelestialRingScale;
+        for (int32 Index = 0; Index < CelestialRingNodes; ++Index)
+        {
+            const float Angle = UE_TWO_PI * Index / CelestialRingNodes;
+            NodeLocations.Add(Source.LastLocation + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * RingRadius);
+        }
+
+        FObstacle& Obstacle = Obstacles.AddDefaulted_GetRef();
+        Obstacle.A = Obstacle.B = To2D(Source.LastLocation);
+        Obstacle.Radius = InfluenceDistance;
+        Obstacle.Kind = EObstacleKind::Blocking;
+
+        Source.NumNodes = NodeLocations.Num() - Source.FirstNode;
+        Source.NumObstacles = Obstacles.Num() - Source.FirstObstacle;
+    }
+}
+
+void USolaraqNavGraphSubsystem::AddAsteroidFieldSources(UWorld& World)
+{
+    for (TActorIterator<AAsteroidFieldGenerator> It(&World); It; ++It)
+    {
+        const AAsteroidFieldGenerator* Field = *It;
+        const USplineComponent* Spline = Field->GetSplineComponent();
+        if (!Spline || Field->NumberOfInstances <= 0 || Spline->GetNumberOfSplinePoints() < 2)
+        {
+            continue;
+        }
+
+        FSource& Source = Sources.AddDefaulted_GetRef();
+        Source.Actor = Field;
+        Source.LastLocation = Field->GetActorLocation();
+        Source.FirstNode = NodeLocations.Num();
+        Source.FirstObstacle = Obstacles.Num();
+
+        const float ActorScale = Field->GetActorScale3D().GetMax();
+        const float SplineLength = Spline->GetSplineLength();
+        const int32 NumSamples = FMath::Max(2, FMath::CeilToInt32(SplineLength / BeltNodeSpacing) + 1);
+
+        if (Field->bFillArea)
+        {
+            // Treat a filled field as a disc around the spline
+            FVector Center = FVector::ZeroVector;
+            TArray<FVector, TInlineAllocator<64>> Samples;
+            for (int32 Index = 0; Index < NumSamples; ++Index)
+            {
+                const float Distance = SplineLength * Index / (NumSamples - 1);
+                Samples.Add(Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World));
+                Center += Samples.Last();
+            }
+            Center /= Samples.Num();
+
+            float Radius = 0.0f;
+            for (const FVector& Sample : Samples)
+            {
+                Radius = FMath::Max(Radius, FVector::Dist2D(Center, Sample));
+            }
+
+            const float RingRadius = Radius + BeltClearance;
+            const int32 RingNodes = FMath::Max(CelestialRingNodes, FMath::CeilToInt32(UE_TWO_PI * RingRadius / BeltNodeSpacing));
+            for (int32 Index = 0; Index < RingNodes; ++Index)
+            {
+                const float Angle = UE_TWO_PI * Index / RingNodes;
+                NodeLocations.Add(Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * RingRadius);
+            }
+
+            FObstacle& Obstacle = Obstacles.AddDefaulted_GetRef();
+            Obstacle.A = Obstacle.B = To2D(Center);
+            Obstacle.Radius = Radius;
+            Obstacle.Kind = EObstacleKind::Costly;
+        }
+        else
+        {
+            // Belt: nodes on both sides, a chain of capsules along the spline
+            const float HalfWidth = Field->BeltWidth * 0.5f * ActorScale;
+            FVector PreviousLocation = FVector::ZeroVector;
+            for (int32 Index = 0; Index < NumSamples; ++Index)
+            {
+                const float Distance = SplineLength * Index / (NumSamples - 1);
+                const FVector Location = Spline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+                const FVector Right = Spline->GetRightVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World).GetSafeNormal2D();
+
+                NodeLocations.Add(Location + Right * (HalfWidth + BeltClearance));
+                NodeLocations.Add(Location - Right * (HalfWidth + BeltClearance));
+
+                if (Index > 0)
+                {
+                    FObstacle& Obstacle = Obstacles.AddDefaulted_GetRef();
+                    Obstacle.A = To2D(PreviousLocation);
+                    Obstacle.B = To2D(Location);
+                    Obstacle.Radius = HalfWidth;
+                    Obstacle.Kind = EObstacleKind::Costly;
+                }
+                PreviousLocation = Location;
+            }
+        }
+
+        Source.NumNodes = NodeLocations.Num() - Source.FirstNode;
+        Source.NumObstacles = Obstacles.Num() - Source.FirstObstacle;
+    }
+}
+
+void USolaraqNavGraphSubsystem::AddDockingSources(UWorld& World)
+{
+    for (TActorIterator<AActor> It(&World); It; ++It)
+    {
+        const AActor* Station = *It;
+        if (!Station->FindComponentByClass<UDockingPadComponent>())
+        {
+            continue;
+        }
+
+        // One node per station; stations often sit inside an influence sphere, which edges from the node may leave
+        FSource& Source = Sources.AddDefaulted_GetRef();
+        Source.Actor = Station;
+        Source.LastLocation = Station->GetActorLocation();
+        Source.FirstNode = NodeLocations.Add(Source.LastLocation);
+        Source.NumNodes = 1;
+        Source.FirstObstacle = Obstacles.Num();
+        Source.NumObstacles = 0;
+    }
+}
+
+// --- Edges ---
+
+bool USolaraqNavGraphSubsystem::SegmentHitsObstacle(const FVector2D& From, const FVector2D& To, EObstacleKind Kind) const
+{
+    for (const FObstacle& Obstacle : Obstacles)
+    {
+        if (Obstacle.Kind != Kind)
+        {
+            continue;
+        }
+
+        const float RadiusSq = FMath::Square(Obstacle.Radius);
+        // Obstacles containing either end are ignored, otherwise nothing inside an influence sphere could ever leave it
+        if (PointSegmentDistSquared(From, Obstacle.A, Obstacle.B) < RadiusSq || PointSegmentDistSquared(To, Obstacle.A, Obstacle.B) < RadiusSq)
+        {
+            continue;
+        }
+        if (SegmentSegmentDistSquared(From, To, Obstacle.A, Obstacle.B) < RadiusSq)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool USolaraqNavGraphSubsystem::IsSegmentClear(const FVector& From, const FVector& To) const
+{
+    return !SegmentHitsObstacle(To2D(From), To2D(To), EObstacleKind::Blocking);
+}
+
+void USolaraqNavGraphSubsystem::EvaluateCandidate(FCandidateEdge& Candidate) const
+{
+    const FVector2D A = To2D(NodeLocations[Candidate.NodeA]);
+    const FVector2D B = To2D(NodeLocations[Candidate.NodeB]);
+
+    Candidate.bBlocked = SegmentHitsObstacle(A, B, EObstacleKind::Blocking);
+    const float Length = FVector2D::Distance(A, B);
+    Candidate.Cost = SegmentHitsObstacle(A, B, EObstacleKind::Costly) ? Length * BeltCrossingCostMultiplier : Length;
+}
+
+void USolaraqNavGraphSubsystem::BuildAllCandidates()
+{
+    Candidates.Reset();
+    const float MaxLinkDistanceSq = FMath::Square(MaxLinkDistance);
+    for (int32 NodeA = 0; NodeA < NodeLocations.Num(); ++NodeA)
+    {
+        for (int32 NodeB = NodeA + 1; NodeB < NodeLocations.Num(); ++NodeB)
+        {
+            if (FVector::DistSquared2D(NodeLocations[NodeA], NodeLocations[NodeB]) <= MaxLinkDistanceSq)
+            {
+                FCandidateEdge& Candidate = Candidates.AddDefaulted_GetRef();
+                Candidate.NodeA = NodeA;
+                Candidate.NodeB = NodeB;
+                EvaluateCandidate(Candidate);
+            }
+        }
+    }
+}
+
+void USolaraqNavGraphSubsystem::RebuildAdjacency()
+{
+    Adjacency.SetNum(NodeLocations.Num());
+    for (auto& Links : Adjacency)
+    {
+        Links.Reset();
+    }
+
+    for (const FCandidateEdge& Candidate : Candidates)
+    {
+        if (!Candidate.bBlocked)
+        {
+            Adjacency[Candidate.NodeA].Add({ Candidate.NodeB, Candidate.Cost });
+            Adjacency[Candidate.NodeB].Add({ Candidate.NodeA, Candidate.Cost });
+        }
+    }
+}
+
+// --- Incremental updates ---
+
+void USolaraqNavGraphSubsystem::Tick(float DeltaTime)
+{
+    TimeUntilSourcePoll -= DeltaTime;
+    if (TimeUntilSourcePoll > 0.0f || Sources.Num() == 0)
+    {
+        return;
+    }
+    TimeUntilSourcePoll = SourcePollInterval;
+
+    for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+    {
+        const AActor* SourceActor = Sources[SourceIndex].Actor.Get();
+        if (!SourceActor)
+        {
+            continue; // Destroyed sources keep their (now stale) nodes; harmless and rare
+        }
+
+        const FVector Location = SourceActor->GetActorLocation();
+        const FVector Delta = Location - Sources[SourceIndex].LastLocation;
+        if (Delta.SizeSquared2D() > FMath::Square(SourceMoveTolerance))
+        {
+            HandleSourceMoved(SourceIndex, Delta);
+            Sources[SourceIndex].LastLocation = Location;
+        }
+    }
+}
+
+void USolaraqNavGraphSubsystem::HandleSourceMoved(int32 SourceIndex, const FVector& Delta)
+{
+    const FSource& Source = Sources[SourceIndex];
+    const FVector2D Delta2D = To2D(Delta);
+
+    // Bodies move rigidly (rotation is ignored); shift nodes and obstacles, remembering the swept footprint
+    FBox2D AffectedArea(ForceInit);
+    for (int32 Index = Source.FirstObstacle; Index < Source.FirstObstacle + Source.NumObstacles; ++Index)
+    {
+        FObstacle& Obstacle = Obstacles[Index];
+        const FVector2D Extent(Obstacle.Radius, Obstacle.Radius);
+        AffectedArea += FBox2D(Obstacle.A.ComponentMin(Obstacle.B) - Extent, Obstacle.A.ComponentMax(Obstacle.B) + Extent);
+        Obstacle.A += Delta2D;
+        Obstacle.B += Delta2D;
+        AffectedArea += FBox2D(Obstacle.A.ComponentMin(Obstacle.B) - Extent, Obstacle.A.ComponentMax(Obstacle.B) + Extent);
+    }
+    for (int32 Index = Source.FirstNode; Index < Source.FirstNode + Source.NumNodes; ++Index)
+    {
+        NodeLocations[Index] += Delta;
+    }
+
+    const auto IsMovedNode = [&Source](int32 Node)
+    {
+        return Node >= Source.FirstNode && Node < Source.FirstNode + Source.NumNodes;
+    };
+
+    // Candidates of moved nodes are rebuilt from scratch (their neighbour set changed)
+    Candidates.RemoveAllSwap([&IsMovedNode](const FCandidateEdge& Candidate)
+    {
+        return IsMovedNode(Candidate.NodeA) || IsMovedNode(Candidate.NodeB);
+    });
+
+    // Other edges only need re-testing if they pass through the old or new footprint
+    if (AffectedArea.bIsValid)
+    {
+        for (FCandidateEdge& Candidate : Candidates)
+        {
+            const FVector2D A = To2D(NodeLocations[Candidate.NodeA]);
+            const FVector2D B = To2D(NodeLocations[Candidate.NodeB]);
+            if (AffectedArea.Intersect(FBox2D(A.ComponentMin(B), A.ComponentMax(B))))
+            {
+                EvaluateCandidate(Candidate);
+            }
+        }
+    }
+
+    const float MaxLinkDistanceSq = FMath::Square(MaxLinkDistance);
+    for (int32 NodeA = Source.FirstNode; NodeA < Source.FirstNode + Source.NumNodes; ++NodeA)
+    {
+        for (int32 NodeB = 0; NodeB < NodeLocations.Num(); ++NodeB)
+        {
+            // Pairs inside the moved set are added once (NodeA < NodeB)
+            if (NodeB == NodeA || (IsMovedNode(NodeB) && NodeB < NodeA))
+            {
+                continue;
+            }
+            if (FVector::DistSquared2D(NodeLocations[NodeA], NodeLocations[NodeB]) <= MaxLinkDistanceSq)
+            {
+                FCandidateEdge& Candidate = Candidates.AddDefaulted_GetRef();
+                Candidate.NodeA = NodeA;
+                Candidate.NodeB = NodeB;
+                EvaluateCandidate(Candidate);
+            }
+        }
+    }
+
+    RebuildAdjacency();
+    PathCache.Empty();
+    ++GraphVersion;
+
+    UE_LOG(LogSolaraqAI, Verbose, TEXT("NavGraph: Source %s moved %.0f, graph updated (version %u)."),
+        *GetNameSafe(Source.Actor.Get()), Delta.Size2D(), GraphVersion);
+}
+
+// --- Queries ---
+
+int32 USolaraqNavGraphSubsystem::FindNearestVisibleNode(const FVector& Location) const
+{
+    struct FNodeDistance
+    {
+        int32 Node;
+        float DistSq;
+    };
+
+    // The nearest few are enough; if none of them is visible the location is boxed in.
+    // Keep them in a bounded max-heap (farthest on top) instead of sorting every node.
+    constexpr int32 MaxVisibilityTests = 16;
+    const auto FarthestFirst = [](const FNodeDistance& A, const FNodeDistance& B) { return A.DistSq > B.DistSq; };
+
+    TArray<FNodeDistance, TInlineAllocator<MaxVisibilityTests>> Nearest;
+    for (int32 Node = 0; Node < NodeLocations.Num(); ++Node)
+    {
+        const float DistSq = FVector::DistSquared2D(Location, NodeLocations[Node]);
+        if (Nearest.Num() < MaxVisibilityTests)
+        {
+            Nearest.HeapPush({ Node, DistSq }, FarthestFirst);
+        }
+        else if (DistSq < Nearest.HeapTop().DistSq)
+        {
+            Nearest.HeapPopDiscard(FarthestFirst, EAllowShrinking::No);
+            Nearest.HeapPush({ Node, DistSq }, FarthestFirst);
+        }
+    }
+    Nearest.Sort([](const FNodeDistance& A, const FNodeDistance& B) { return A.DistSq < B.DistSq; });
+
+    for (const FNodeDistance& Candidate : Nearest)
+    {
+        if (IsSegmentClear(Location, NodeLocations[Candidate.Node]))
+        {
+            return Candidate.Node;
+        }
+    }
+    return INDEX_NONE;
+}
+
+TSharedPtr<const FSolaraqNavPath> USolaraqNavGraphSubsystem::FindPath(const FVector& From, const FVector& To)
+{
+    if (!DirectPath.IsValid() || IsSegmentClear(From, To))
+    {
+        return DirectPath;
+    }
+
+    const int32 StartNode = FindNearestVisibleNode(From);
+    const int32 GoalNode = FindNearestVisibleNode(To);
+    if (StartNode == INDEX_NONE || GoalNode == INDEX_NONE)
+    {
+        return nullptr;
+    }
+
+    const uint64 Key = MakePathKey(StartNode, GoalNode);
+    if (const TSharedPtr<const FSolaraqNavPath>* Cached = PathCache.Find(Key))
+    {
+        return *Cached;
+    }
+
+    if (PathCache.Num() >= MaxCachedPaths)
+    {
+        PathCache.Empty();
+    }
+
+    TSharedPtr<const FSolaraqNavPath> Path = RunAStar(StartNode, GoalNode);
+    PathCache.Add(Key, Path); // Failures are cached too, so unreachable goals don't re-run A* every request
+    return Path;
+}
+
+TSharedPtr<const FSolaraqNavPath> USolaraqNavGraphSubsystem::RunAStar(int32 StartNode, int32 GoalNode) const
+{
+    struct FOpenEntry
+    {
+        int32 Node;
+        float F;
+    };
+    const auto OpenPredicate = [](const FOpenEntry& A, const FOpenEntry& B) { return A.F < B.F; };
+
+    const int32 NumNodes = NodeLocations.Num();
+    TArray<float> G;
+    G.Init(TNumericLimits<float>::Max(), NumNodes);
+    TArray<int32> Parent;
+    Parent.Init(INDEX_NONE, NumNodes);
+
+    const FVector& GoalLocation = NodeLocations[GoalNode];
+    TArray<FOpenEntry> Open;
+    G[StartNode] = 0.0f;
+    Open.HeapPush({ StartNode, FVector::Dist2D(NodeLocations[StartNode], GoalLocation) }, OpenPredicate);
+
+    while (Open.Num() > 0)
+    {
+        FOpenEntry Current;
+        Open.HeapPop(Current, OpenPredicate, EAllowShrinking::No);
+        if (Current.Node == GoalNode)
+        {
+            break;
+        }
+        // Stale heap entry (a cheaper route was found after it was pushed)
+        if (Current.F - FVector::Dist2D(NodeLocations[Current.Node], GoalLocation) > G[Current.Node] + KINDA_SMALL_NUMBER)
+        {
+            continue;
+        }
+
+        for (const FLink& Link : Adjacency[Current.Node])
+        {
+            const float NewG = G[Current.Node] + Link.Cost;
+            if (NewG < G[Link.Node])
+            {
+                G[Link.Node] = NewG;
+                Parent[Link.Node] = Current.Node;
+                // Costs are >= straight-line distance, so the 2D distance heuristic stays admissible
+                Open.HeapPush({ Link.Node, NewG + FVector::Dist2D(NodeLocations[Link.Node], GoalLocation) }, OpenPredicate);
+            }
+        }
+    }
+
+    if (StartNode != GoalNode && Parent[GoalNode] == INDEX_NONE)
+    {
+        UE_LOG(LogSolaraqAI, Verbose, TEXT("NavGraph: No route between nodes %d and %d."), StartNode, GoalNode);
+        return nullptr;
+    }
+
+    TSharedRef<FSolaraqNavPath> Path = MakeShared<FSolaraqNavPath>();
+    for (int32 Node = GoalNode; Node != INDEX_NONE; Node = Parent[Node])
+    {
+        Path->Waypoints.Add(NodeLocations[Node]);
+    }
+    Algo::Reverse(Path->Waypoints);
+    return Path;
+}
@@ -0,0 +1,345 @@
+// SolaraqObstacleFieldSubsystem.cpp
+
+#include "AI/SolaraqObstacleFieldSubsystem.h"
+#include "Engine/World.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqObstacleFieldSubsystem* USolaraqObstacleFieldSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqObstacleFieldSubsystem>() : nullptr;
+}
+
+bool USolaraqObstacleFieldSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqObstacleFieldSubsystem::Deinitialize()
+{
+    Obstacles.Empty();
+    CellDistances.Empty();
+    CellAwayDirections.Empty();
+    PendingRegions.Empty();
+    Buckets.Empty();
+    CandidateScratch.Empty();
+    GridSize = FIntPoint::ZeroValue;
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqObstacleFieldSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqObstacleFieldSubsystem, STATGROUP_Tickables);
+}
+
+// --- Registration ---
+
+int32 USolaraqObstacleFieldSubsystem::AddObstacle(const FVector& Location, float Radius)
+{
+    FObstacle Obstacle;
+    Obstacle.Center = FVector2D(Location);
+    Obstacle.Radius = FMath::Max(0.0f, Radius);
+
+    const int32 Handle = Obstacles.Add(Obstacle);
+    MarkDirty(Obstacle);
+    if (!bNeedsFullRebuild)
+    {
+        BucketObstacle(Handle, Obstacle);
+    }
+    return Handle;
+}
+
+void USolaraqObstacleFieldSubsystem::UpdateObstacle(int32 ObstacleHandle, const FVector& Location, float Radius)
+{
+    if (!Obstacles.IsValidIndex(ObstacleHandle))
+    {
+        return;
+    }
+
+    FObstacle& Obstacle = Obstacles[ObstacleHandle];
+    const FVector2D NewCenter(Location);
+    const float NewRadius = FMath::Max(0.0f, Radius);
+
+    // Owners report every transform change; sub-cell moves don't change the field
+    const float Tolerance = GridCellSize * 0.25f;
+    if (FVector2D::DistSquared(Obstacle.Center, NewCenter) < FMath::Square(Tolerance) && FMath::Abs(Obstacle.Radius - NewRadius) < Tolerance)
+    {
+        return;
+    }
+
+    UnbucketObstacle(ObstacleHandle, Obstacle);
+    MarkDirty(Obstacle, true); // Old footprint
+
+    Obstacle.Center = NewCenter;
+    Obstacle.Radius = NewRadius;
+    MarkDirty(Obstacle); // New footprint
+    if (!bNeedsFullRebuild)
+    {
+        BucketObstacle(ObstacleHandle, Obstacle);
+    }
+}
+
+void USolaraqObstacleFieldSubsystem::RemoveObstacle(int32& ObstacleHandle)
+{
+    if (Obstacles.IsValidIndex(ObstacleHandle))
+    {
+        const FObstacle Removed = Obstacles[ObstacleHandle];
+        UnbucketObstacle(ObstacleHandle, Removed);
+        Obstacles.RemoveAt(ObstacleHandle);
+        MarkDirty(Removed, true);
+    }
+    ObstacleHandle = INDEX_NONE;
+}
+
+bool USolaraqObstacleFieldSubsystem::FitsInGrid(const FObstacle& Obstacle) const
+{
+    if (GridSize.X <= 0 || GridSize.Y <= 0)
+    {
+        return false;
+    }
+    const float Reach = Obstacle.Radius + InfluenceDistance;
+    const FVector2D Max = GridOrigin + FVector2D(GridSize) * GridCellSize;
+    return Obstacle.Center.X - Reach >= GridOrigin.X && Obstacle.Center.Y - Reach >= GridOrigin.Y
+        && Obstacle.Center.X + Reach <= Max.X && Obstacle.Center.Y + Reach <= Max.Y;
+}
+
+bool USolaraqObstacleFieldSubsystem::GetInfluenceCellRect(const FObstacle& Obstacle, FIntRect& OutRect) const
+{
+    const float Reach = Obstacle.Radius + InfluenceDistance;
+    const FVector2D MinLocal = (Obstacle.Center - FVector2D(Reach) - GridOrigin) / GridCellSize;
+    const FVector2D MaxLocal = (Obstacle.Center + FVector2D(Reach) - GridOrigin) / GridCellSize;
+
+    // Max is exclusive
+    OutRect.Min = FIntPoint(FMath::Max(0, FMath::FloorToInt(MinLocal.X)), FMath::Max(0, FMath::FloorToInt(MinLocal.Y)));
+    OutRect.Max = FIntPoint(FMath::Min(GridSize.X, FMath::CeilToInt(MaxLocal.X) + 1), FMath::Min(GridSize.Y, FMath::CeilToInt(MaxLocal.Y) + 1));
+    return OutRect.Min.X < OutRect.Max.X && OutRect.Min.Y < OutRect.Max.Y;
+}
+
+void USolaraqObstacleFieldSubsystem::MarkDirty(const FObstacle& Obstacle, bool bRemoved)
+{
+    if (bNeedsFullRebuild)
+    {
+        return; // Everything gets rebuilt anyway
+    }
+
+    if (!bRemoved && !FitsInGrid(Obstacle))
+    {
+        // Anything added or moved beyond the bounds needs a bigger grid
+        bNeedsFullRebuild = true;
+        PendingRegions.Reset();
+        return;
+    }
+
+    // Removed footprints are clipped to the grid; nothing to do if they were fully outside it
+    FIntRect Rect;
+    if (GridSize.X > 0 && GridSize.Y > 0 && GetInfluenceCellRect(Obstacle, Rect))
+    {
+        PendingRegions.Add(Rect);
+    }
+}
+
+FIntRect USolaraqObstacleFieldSubsystem::GetBucketRect(const FIntRect& CellRect) const
+{
+    // Inclusive max
+    return FIntRect(CellRect.Min / BucketCells, (CellRect.Max - FIntPoint(1, 1)) / BucketCells);
+}
+
+void USolaraqObstacleFieldSubsystem::BucketObstacle(int32 ObstacleHandle, const FObstacle& Obstacle)
+{
+    FIntRect CellRect;
+    if (!GetInfluenceCellRect(Obstacle, CellRect))
+    {
+        return;
+    }
+
+    const FIntRect BucketRect = GetBucketRect(CellRect);
+    for (int32 Y = BucketRect.Min.Y; Y <= BucketRect.Max.Y; ++Y)
+    {
+        for (int32 X = BucketRect.Min.X; X <= BucketRect.Max.X; ++X)
+        {
+            Buckets.FindOrAdd(FIntPoint(X, Y)).Add(ObstacleHandle);
+        }
+    }
+}
+
+void USolaraqObstacleFieldSubsystem::UnbucketObstacle(int32 ObstacleHandle, const FObstacle& Obstacle)
+{
+    FIntRect CellRect;
+    if (!GetInfluenceCellRect(Obstacle, CellRect))
+    {
+        return;
+    }
+
+    const FIntRect BucketRect = GetBucketRect(CellRect);
+    for (int32 Y = BucketRect.Min.Y; Y <= BucketRect.Max.Y; ++Y)
+    {
+        for (int32 X = BucketRect.Min.X; X <= BucketRect.Max.X; ++X)
+        {
+            if (TArray<int32>* Bucket = Buckets.Find(FIntPoint(X, Y)))
+            {
+                Bucket->RemoveSingleSwap(ObstacleHandle, EAllowShrinking::No);
+            }
+        }
+    }
+}
+
+// --- Tick / Rebuild ---
+
+void USolaraqObstacleFieldSubsystem::Tick(float DeltaTime)
+{
+    if (bNeedsFullRebuild)
+    {
+        RebuildAll();
+        return;
+    }
+
+    for (const FIntRect& Region : PendingRegions)
+    {
+        RebuildRegion(Region);
+    }
+    PendingRegions.Reset();
+}
+
+void USolaraqObstacleFieldSubsystem::RebuildAll()
+{
+    bNeedsFullRebuild = false;
+    PendingRegions.Reset();
+    Buckets.Reset();
+
+    if (Obstacles.Num() == 0)
+    {
+        GridSize = FIntPoint::ZeroValue;
+        CellDistances.Reset();
+        CellAwayDirections.Reset();
+        return;
+    }
+
+    // --- Bounds of all obstacle influence areas, with one extra InfluenceDistance of slack for later additions ---
+    FBox2D Bounds(ForceInit);
+    for (const FObstacle& Obstacle : Obstacles)
+    {
+        const float Reach = Obstacle.Radius + InfluenceDistance * 2.0f;
+        Bounds += Obstacle.Center - FVector2D(Reach);
+        Bounds += Obstacle.Center + FVector2D(Reach);
+    }
+
+    const FVector2D Extent = Bounds.GetSize();
+    GridCellSize = FMath::Max3(CellSize, static_cast<float>(Extent.X) / MaxCellsPerAxis, static_cast<float>(Extent.Y) / MaxCellsPerAxis);
+    GridOrigin = Bounds.Min;
+    GridSize = FIntPoint(FMath::Max(1, FMath::CeilToInt(Extent.X / GridCellSize)), FMath::Max(1, FMath::CeilToInt(Extent.Y / GridCellSize)));
+
+    const int32 NumCells = GridSize.X * GridSize.Y;
+    CellDistances.SetNumUninitialized(NumCells);
+    CellAwayDirections.SetNumUninitialized(NumCells);
+
+    for (auto It = Obstacles.CreateConstIterator(); It; ++It)
+    {
+        BucketObstacle(It.GetIndex(), *It);
+    }
+
+    RebuildRegion(FIntRect(FIntPoint::ZeroValue, GridSize));
+
+    UE_LOG(LogSolaraqAI, Log, TEXT("ObstacleField: Rebuilt %dx%d grid (cell %.0f) from %d obstacles."), GridSize.X, GridSize.Y, GridCellSize, Obstacles.Num());
+}
+
+void USolaraqObstacleFieldSubsystem::RebuildRegion(const FIntRect& CellRect)
+{
+    // Reset region to "free"
+    for (int32 Y = CellRect.Min.Y; Y < CellRect.Max.Y; ++Y)
+    {
+        for (int32 X = CellRect.Min.X; X < CellRect.Max.X; ++X)
+        {
+            const int32 Index = CellIndex(X, Y);
+            CellDistances[Index] = InfluenceDistance;
+            CellAwayDirections[Index] = FVector2f::ZeroVector;
+        }
+    }
+
+    // Re-stamp the obstacles bucketed around the region whose influence overlaps it
+    CandidateScratch.Reset();
+    const FIntRect BucketRect = GetBucketRect(CellRect);
+    for (int32 Y = BucketRect.Min.Y; Y <= BucketRect.Max.Y; ++Y)
+    {
+        for (int32 X = BucketRect.Min.X; X <= BucketRect.Max.X; ++X)
+        {
+            if (const TArray<int32>* Bucket = Buckets.Find(FIntPoint(X, Y)))
+            {
+                CandidateScratch.Append(*Bucket);
+            }
+        }
+    }
+    CandidateScratch.Sort(); // Obstacles spanning several buckets show up once per bucket
+
+    for (int32 Index = 0; Index < CandidateScratch.Num(); ++Index)
+    {
+        if (Index > 0 && CandidateScratch[Index] == CandidateScratch[Index - 1])
+        {
+            continue;
+        }
+
+        const FObstacle& Obstacle = Obstacles[CandidateScratch[Index]];
+        FIntRect ObstacleRect;
+        if (GetInfluenceCellRect(Obstacle, ObstacleRect))
+        {
+            ObstacleRect.Clip(CellRect);
+            if (ObstacleRect.Min.X < ObstacleRect.Max.X && ObstacleRect.Min.Y < ObstacleRect.Max.Y)
+            {
+                StampObstacle(Obstacle, ObstacleRect);
+            }
+        }
+    }
+}
+
+void USolaraqObstacleFieldSubsystem::StampObstacle(const FObstacle& Obstacle, const FIntRect& ClipRect)
+{
+    for (int32 Y = ClipRect.Min.Y; Y < ClipRect.Max.Y; ++Y)
+    {
+        for (int32 X = ClipRect.Min.X; X < ClipRect.Max.X; ++X)
+        {
+            const FVector2D CellCenter = GridOrigin + (FVector2D(X, Y) + 0.5) * GridCellSize;
+            const FVector2D Away = CellCenter - Obstacle.Center;
+            const float CenterDistance = Away.Size();
+            const float SurfaceDistance = FMath::Max(0.0f, CenterDistance - Obstacle.Radius);
+
+            const int32 Index = CellIndex(X, Y);
+            if (SurfaceDistance < CellDistances[Index])
+            {
+                CellDistances[Index] = SurfaceDistance;
+                CellAwayDirections[Index] = CenterDistance > KINDA_SMALL_NUMBER ? FVector2f(Away / CenterDistance) : FVector2f(1.0f, 0.0f);
+            }
+        }
+    }
+}
+
+// --- Queries ---
+
+int32 USolaraqObstacleFieldSubsystem::CellIndexAt(const FVector& Location) const
+{
+    const int32 X = FMath::FloorToInt((Location.X - GridOrigin.X) / GridCellSize);
+    const int32 Y = FMath::FloorToInt((Location.Y - GridOrigin.Y) / GridCellSize);
+    if (X < 0 || Y < 0 || X >= GridSize.X || Y >= GridSize.Y)
+    {
+        return INDEX_NONE;
+    }
+    return CellIndex(X, Y);
+}
+
+float USolaraqObstacleFieldSubsystem::SampleDistance(const FVector& Location) const
+{
+    const int32 Index = CellIndexAt(Location);
+    return Index != INDEX_NONE ? CellDistances[Index] : InfluenceDistance;
+}
+
+FVector USolaraqObstacleFieldSubsystem::SampleAvoidance(const FVector& Location) const
+{
+    const int32 Index = CellIndexAt(Location);
+    if (Index == INDEX_NONE || InfluenceDistance <= 0.0f)
+    {
+        return FVector::ZeroVector;
+    }
+
+    const float Strength = 1.0f - FMath::Clamp(CellDistances[Index] / InfluenceDistance, 0.0f, 1.0f);
+    const FVector2f& Away = CellAwayDirections[Index];
+    return FVector(Away.X, Away.Y, 0.0f) * Strength;
+}
@@ -0,0 +1,273 @@
+// SolaraqShipAvoidanceSubsystem.cpp
+
+#include "AI/SolaraqShipAvoidanceSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqShipAvoidanceSubsystem* USolaraqShipAvoidanceSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqShipAvoidanceSubsystem>() : nullptr;
+}
+
+bool USolaraqShipAvoidanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqShipAvoidanceSubsystem::Deinitialize()
+{
+    Bodies.Empty();
+    Positions.Empty();
+    Velocities.Empty();
+    Radii.Empty();
+    bActive.Empty();
+    FreeHandles.Empty();
+    SortedAgents.Empty();
+    CellRanges.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqShipAvoidanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqShipAvoidanceSubsystem, STATGROUP_Tickables);
+}
+
+int32 USolaraqShipAvoidanceSubsystem::RegisterAgent(UPrimitiveComponent* Body, float Radius)
+{
+    if (!Body)
+    {
+        return INDEX_NONE;
+    }
+
+    int32 Handle;
+    if (FreeHandles.Num() > 0)
+    {
+        Handle = FreeHandles.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        Handle = Bodies.AddDefaulted();
+        Positions.AddZeroed();
+        Velocities.AddZeroed();
+        Radii.AddZeroed();
+        bActive.Add(false);
+    }
+
+    const FVector Location = Body->GetComponentLocation();
+    Bodies[Handle] = Body;
+    Positions[Handle] = FVector2D(Location.X, Location.Y);
+    Velocities[Handle] = FVector2D::ZeroVector;
+    Radii[Handle] = FMath::Max(Radius, 1.0f);
+    bActive[Handle] = true;
+    return Handle;
+}
+
+void USolaraqShipAvoidanceSubsystem::UnregisterAgent(int32& Handle)
+{
+    if (bActive.IsValidIndex(Handle) && bActive[Handle])
+    {
+        bActive[Handle] = false;
+        Bodies[Handle].Reset();
+        FreeHandles.Add(Handle);
+        // Stale grid entries are skipped via bActive until the next rebuild
+    }
+    Handle = INDEX_NONE;
+}
+
+void USolaraqShipAvoidanceSubsystem::Tick(float DeltaTime)
+{
+    LastDeltaTime = FMath::Max(DeltaTime, KINDA_SMALL_NUMBER);
+    RebuildGrid();
+}
+
+FIntPoint USolaraqShipAvoidanceSubsystem::GetCell(const FVector2D& Location) const
+{
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+void USolaraqShipAvoidanceSubsystem::RebuildGrid()
+{
+    // --- Snapshot positions / velocities ---
+    SortedAgents.Reset();
+    for (int32 Handle = 0; Handle < Bodies.Num(); ++Handle)
+    {
+        if (!bActive[Handle])
+        {
+            continue;
+        }
+        const UPrimitiveComponent* Body = Bodies[Handle].Get();
+        if (!Body)
+        {
+            bActive[Handle] = false;
+            FreeHandles.Add(Handle);
+            continue;
+        }
+        const FVector Location = Body->GetComponentLocation();
+        const FVector Velocity = Body->IsSimulatingPhysics() ? Body->GetPhysicsLinearVelocity() : Body->GetComponentVelocity();
+        Positions[Handle] = FVector2D(Location.X, Location.Y);
+        Velocities[Handle] = FVector2D(Velocity.X, Velocity.Y);
+        SortedAgents.Add(Handle);
+    }
+
+    // --- Bucket by cell (sort + ranges, no per-cell allocations) ---
+    SortedAgents.Sort([this](int32 A, int32 B)
+    {
+        const FIntPoint CellA = GetCell(Positions[A]);
+        const FIntPoint CellB = GetCell(Positions[B]);
+        return CellA.X != CellB.X ? CellA.X < CellB.X : CellA.Y < CellB.Y;
+    });
+
+    CellRanges.Reset();
+    for (int32 Index = 0; Index < SortedAgents.Num(); ++Index)
+    {
+        FIntPoint& Range = CellRanges.FindOrAdd(GetCell(Positions[SortedAgents[Index]]), FIntPoint(Index, 0));
+        ++Range.Y;
+    }
+}
+
+FVector USolaraqShipAvoidanceSubsystem::ComputeAvoidanceVelocity(int32 Handle, const FVector& DesiredVelocity, const FSolaraqAvoidanceParams& Params) const
+{
+    if (!bActive.IsValidIndex(Handle) || !bActive[Handle] || Params.TimeHorizon <= 0.0f)
+    {
+        return DesiredVelocity;
+    }
+
+    const FVector2D Position = Positions[Handle];
+    const FVector2D Velocity = Velocities[Handle];
+    const float Radius = Radii[Handle];
+
+    // --- Gather the closest neighbours from the surrounding cells ---
+    struct FNeighbor
+    {
+        int32 Handle;
+        float DistSq;
+    };
+    TArray<FNeighbor, TInlineAllocator<16>> Neighbors;
+
+    const float NeighborRadiusSq = FMath::Square(Params.NeighborRadius);
+    const int32 CellReach = FMath::Max(1, FMath::CeilToInt32(Params.NeighborRadius / CellSize));
+    const FIntPoint Center = GetCell(Position);
+    for (int32 X = Center.X - CellReach; X <= Center.X + CellReach; ++X)
+    {
+        for (int32 Y = Center.Y - CellReach; Y <= Center.Y + CellReach; ++Y)
+        {
+            const FIntPoint* Range = CellRanges.Find(FIntPoint(X, Y));
+            if (!Range)
+            {
+                continue;
+            }
+            for (int32 Index = Range->X; Index < Range->X + Range->Y; ++Index)
+            {
+                const int32 Other = SortedAgents[Index];
+                if (Other == Handle || !bActive[Other])
+                {
+                    continue;
+                }
+                const float DistSq = FVector2D::DistSquared(Position, Positions[Other]);
+                if (DistSq < NeighborRadiusSq)
+                {
+                    Neighbors.Add({ Other, DistSq });
+                }
+            }
+        }
+    }
+
+    if (Neighbors.Num() == 0)
+    {
+        return DesiredVelocity;
+    }
+    if (Neighbors.Num() > Params.MaxNeighbors)
+    {
+        Neighbors.Sort([](const FNeighbor& A, const FNeighbor& B) { return A.DistSq < B.DistSq; });
+        Neighbors.SetNum(Params.MaxNeighbors, EAllowShrinking::No);
+    }
+
+    // --- One ORCA half-plane per neighbour ---
+    const float InvTimeHorizon = 1.0f / Params.TimeHorizon;
+    TArray<FOrcaLine, TInlineAllocator<16>> Lines;
+    for (const FNeighbor& Neighbor : Neighbors)
+    {
+        const FVector2D RelativePosition = Positions[Neighbor.Handle] - Position;
+        const FVector2D RelativeVelocity = Velocity - Velocities[Neighbor.Handle];
+        const float DistSq = Neighbor.DistSq;
+        const float CombinedRadius = Radius + Radii[Neighbor.Handle];
+        const float CombinedRadiusSq = FMath::Square(CombinedRadius);
+
+        FOrcaLine Line;
+        FVector2D U;
+
+        if (DistSq > CombinedRadiusSq)
+        {
+            // No collision yet. Vector from the cut-off circle centre to the relative velocity.
+            const FVector2D W = RelativeVelocity - InvTimeHorizon * RelativePosition;
+            const float WLengthSq = W.SizeSquared();
+            const float DotProduct = FVector2D::DotProduct(W, RelativePosition);
+
+            if (DotProduct < 0.0f && FMath::Square(DotProduct) > CombinedRadiusSq * WLengthSq)
+            {
+                // Project on the cut-off circle
+                const float WLength = FMath::Sqrt(WLengthSq);
+                const FVector2D UnitW = W / WLength;
+                Line.Direction = FVector2D(UnitW.Y, -UnitW.X);
+                U = (CombinedRadius * InvTimeHorizon - WLength) * UnitW;
+            }
+            else
+            {
+                // Project on the nearer leg of the velocity obstacle cone
+                const float Leg = FMath::Sqrt(DistSq - CombinedRadiusSq);
+                if (FVector2D::CrossProduct(RelativePosition, W) > 0.0f)
+                {
+                    Line.Direction = FVector2D(RelativePosition.X * Leg - RelativePosition.Y * CombinedRadius,
+                                               RelativePosition.X * CombinedRadius + RelativePosition.Y * Leg) / DistSq;
+                }
+                else
+                {
+                    Line.Direction = -FVector2D(RelativePosition.X * Leg + RelativePosition.Y * CombinedRadius,
+                                                -RelativePosition.X * CombinedRadius + RelativePosition.Y * Leg) / DistSq;
+                }
+                U = FVector2D::DotProduct(RelativeVelocity, Line.Direction) * Line.Direction - RelativeVelocity;
+            }
+        }
+        else
+        {
+            // Already overlapping: get apart within one frame
+            const float InvTimeStep = 1.0f / LastDeltaTime;
+            const FVector2D W = RelativeVelocity - InvTimeStep * RelativePosition;
+            const float WLength = W.Size();
+            const FVector2D UnitW = WLength > KINDA_SMALL_NUMBER ? W / WLength : FVector2D(1.0f, 0.0f);
+            Line.Direction = FVector2D(UnitW.Y, -UnitW.X);
+            U = (CombinedRadius * InvTimeStep - WLength) * UnitW;
+        }
+
+        // Reciprocal: we only take half of the correction, the other ship takes the rest
+        Line.Point = Velocity + 0.5f * U;
+        Lines.Add(Line);
+    }
+
+    // --- Project the preferred velocity onto the half-planes ---
+    FVector2D Result(DesiredVelocity.X, DesiredVelocity.Y);
+    Result = Result.GetClampedToMaxSize(Params.MaxSpeed);
+    for (int32 Iteration = 0; Iteration < SolverIterations; ++Iteration)
+    {
+        bool bAllSatisfied = true;
+        for (const FOrcaLine& Line : Lines)
+        {
+            // Outside the permitted side?
+            if (FVector2D::CrossProduct(Line.Direction, Line.Point - Result) > 0.0f)
+            {
+                Result = Line.Point + FVector2D::DotProduct(Result - Line.Point, Line.Direction) * Line.Direction;
+                Result = Result.GetClampedToMaxSize(Params.MaxSpeed);
+                bAllSatisfied = false;
+            }
+        }
+        if (bAllSatisfied)
+        {
+            break;
+        }
+    }
+
+    return FVector(Result.X, Result.Y, DesiredVelocity.Z);
+}
@@ -0,0 +1,258 @@
+// SolaraqShipSteeringSubsystem.cpp
+
+#include "AI/SolaraqShipSteeringSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "Chaos/SimCallbackObject.h"
+#include "Chaos/SimCallbackInput.h"
+#include "PBDRigidsSolver.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PhysicsProxy/SingleParticlePhysicsProxy.h"
+#include "Logging/SolaraqLogChannels.h"
+
+// --- Physics-thread side ---
+
+struct FSolaraqSteeringInput : public Chaos::FSimCallbackInput
+{
+    /** Indexed by steering handle; free slots have a null Proxy. */
+    TArray<FSolaraqSteeringCommand> Commands;
+    float CommandTimeout = 0.5f;
+    bool bPopulated = false;
+
+    void Reset()
+    {
+        Commands.Reset();
+        bPopulated = false;
+    }
+};
+
+class FSolaraqSteeringCallback : public Chaos::TSimCallbackObject<FSolaraqSteeringInput>
+{
+public:
+    virtual void OnPreSimulate_Internal() override
+    {
+        const float DeltaTime = static_cast<float>(GetDeltaTime_Internal());
+
+        // Latest command table replaces ours; only channels whose sequence changed restart their age
+        if (const FSolaraqSteeringInput* Input = GetConsumerInput_Internal())
+        {
+            CommandTimeout = Input->CommandTimeout;
+            States.SetNum(Input->Commands.Num());
+            for (int32 Index = 0; Index < Input->Commands.Num(); ++Index)
+            {
+                FState& State = States[Index];
+                const FSolaraqSteeringCommand& Command = Input->Commands[Index];
+                const bool bNewBody = State.Command.Proxy != Command.Proxy;
+                if (bNewBody || State.Command.YawSequence != Command.YawSequence)
+                {
+                    State.YawAge = 0.0f;
+                }
+                if (bNewBody || State.Command.ThrustSequence != Command.ThrustSequence)
+                {
+                    State.ThrustAge = 0.0f;
+                }
+                State.Command = Command;
+            }
+        }
+
+        for (FState& State : States)
+        {
+            const FSolaraqSteeringCommand& Command = State.Command;
+            if (!Command.Proxy)
+            {
+                continue;
+            }
+
+            State.YawAge += DeltaTime;
+            State.ThrustAge += DeltaTime;
+            const bool bSteerYaw = Command.bSteerYaw && (CommandTimeout <= 0.0f || State.YawAge <= CommandTimeout);
+            const bool bThrust = !FMath::IsNearlyZero(Command.ThrustForce) && (CommandTimeout <= 0.0f || State.ThrustAge <= CommandTimeout);
+            if (!bSteerYaw && !bThrust)
+            {
+                continue;
+            }
+
+            Chaos::FRigidBodyHandle_Internal* Body = Command.Proxy->GetPhysicsThreadAPI();
+            if (!Body || Body->ObjectState() != Chaos::EObjectStateType::Dynamic)
+            {
+                continue;
+            }
+
+            const FQuat Rotation(Body->R());
+
+            // PD on yaw against this step's state, applied as a velocity change so gains are mass independent
+            if (bSteerYaw)
+            {
+                const FVector AngularVelocity(Body->W());
+                const float YawError = FMath::FindDeltaAngleDegrees(Rotation.Rotator().Yaw, Command.DesiredYaw);
+                const float YawRate = FMath::RadiansToDegrees(static_cast<float>(AngularVelocity.Z));
+                const float YawAcceleration = FMath::Clamp(
+                    Command.Gains.Stiffness * YawError - Command.Gains.Damping * YawRate,
+                    -Command.Gains.MaxAcceleration, Command.Gains.MaxAcceleration);
+
+                Body->SetW(AngularVelocity + FVector(0.0f, 0.0f, FMath::DegreesToRadians(YawAcceleration * DeltaTime)));
+            }
+
+            if (bThrust)
+            {
+                Body->AddForce(Rotation.GetForwardVector() * Command.ThrustForce);
+            }
+        }
+    }
+
+private:
+    struct FState
+    {
+        FSolaraqSteeringCommand Command;
+        float YawAge = 0.0f;
+        float ThrustAge = 0.0f;
+    };
+
+    TArray<FState> States;
+    float CommandTimeout = 0.5f;
+};
+
+// --- Game-thread side ---
+
+USolaraqShipSteeringSubsystem* USolaraqShipSteeringSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqShipSteeringSubsystem>() : nullptr;
+}
+
+bool USolaraqShipSteeringSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqShipSteeringSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (InWorld.GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    FPhysScene* PhysScene = InWorld.GetPhysicsScene();
+    Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr;
+    if (!Solver)
+    {
+        UE_LOG(LogSolaraqAI, Warning, TEXT("ShipSteering: No physics solver, AI ships will steer on the game thread."));
+        return;
+    }
+
+    Callback = Solver->CreateAndRegisterSimCallbackObject_External<FSolaraqSteeringCallback>();
+}
+
+void USolaraqShipSteeringSubsystem::Deinitialize()
+{
+    if (Callback)
+    {
+        const UWorld* World = GetWorld();
+        FPhysScene* PhysScene = World ? World->GetPhysicsScene() : nullptr;
+        if (Chaos::FPhysicsSolver* Solver = PhysScene ? PhysScene->GetSolver() : nullptr)
+        {
+            Solver->UnregisterAndFreeSimCallbackObject_External(Callback);
+        }
+        Callback = nullptr;
+    }
+    Commands.Empty();
+
+    Super::Deinitialize();
+}
+
+int32 USolaraqShipSteeringSubsystem::RegisterBody(UPrimitiveComponent* Body)
+{
+    const FBodyInstance* BodyInstance = Body ? Body->GetBodyInstance() : nullptr;
+    Chaos::FSingleParticlePhysicsProxy* Proxy = BodyInstance ? BodyInstance->GetPhysicsActorHandle() : nullptr;
+    if (!Callback || !Proxy)
+    {
+        return INDEX_NONE;
+    }
+
+    FSolaraqSteeringCommand Command;
+    Command.Proxy = Proxy;
+    const int32 Handle = Commands.Add(Command);
+    WriteCommand(Handle);
+    return Handle;
+}
+
+void USolaraqShipSteeringSubsystem::UnregisterBody(int32& Handle)
+{
+    if (Commands.IsValidIndex(Handle))
+    {
+        Commands.RemoveAt(Handle);
+        WriteCommand(Handle);
+    }
+    Handle = INDEX_NONE;
+}
+
+void USolaraqShipSteeringSubsystem::SetDesiredYaw(int32 Handle, float DesiredYaw, const FSolaraqYawGains& Gains)
+{
+    if (Commands.IsValidIndex(Handle))
+    {
+        FSolaraqSteeringCommand& Command = Commands[Handle];
+        Command.DesiredYaw = DesiredYaw;
+        Command.Gains = Gains;
+        Command.bSteerYaw = true;
+        ++Command.YawSequence;
+        WriteCommand(Handle);
+    }
+}
+
+void USolaraqShipSteeringSubsystem::SetThrust(int32 Handle, float ThrustForce)
+{
+    if (Commands.IsValidIndex(Handle))
+    {
+        FSolaraqSteeringCommand& Command = Commands[Handle];
+        Command.ThrustForce = ThrustForce;
+        ++Command.ThrustSequence;
+        WriteCommand(Handle);
+    }
+}
+
+void USolaraqShipSteeringSubsystem::ClearCommand(int32 Handle)
+{
+    if (Commands.IsValidIndex(Handle))
+    {
+        FSolaraqSteeringCommand& Command = Commands[Handle];
+        Command.bSteerYaw = false;
+        Command.ThrustForce = 0.0f;
+        ++Command.YawSequence;
+        ++Command.ThrustSequence;
+        WriteCommand(Handle);
+    }
+}
+
+FSolaraqSteeringInput* USolaraqShipSteeringSubsystem::GetFrameInput()
+{
+    FSolaraqSteeringInput* Input = Callback->GetProducerInputData_External();
+    if (!Input->bPopulated)
+    {
+        // Full table, so whichever input the solver ends up consuming is complete
+        Input->Commands.SetNum(Commands.GetMaxIndex());
+        for (int32 Index = 0; Index < Commands.GetMaxIndex(); ++Index)
+        {
+            Input->Commands[Index] = Commands.IsAllocated(Index) ? Commands[Index] : FSolaraqSteeringCommand();
+        }
+        Input->CommandTimeout = CommandTimeout;
+        Input->bPopulated = true;
+    }
+    return Input;
+}
+
+void USolaraqShipSteeringSubsystem::WriteCommand(int32 Handle)
+{
+    if (!Callback)
+    {
+        return;
+    }
+
+    FSolaraqSteeringInput* Input = GetFrameInput();
+    if (Handle >= Input->Commands.Num())
+    {
+        Input->Commands.SetNum(Handle + 1);
+    }
+    Input->Commands[Handle] = Commands.IsAllocated(Handle) ? Commands[Handle] : FSolaraqSteeringCommand();
+}
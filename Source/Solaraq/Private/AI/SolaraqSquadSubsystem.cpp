@@ -0,0 +1,214 @@
+// SolaraqSquadSubsystem.cpp
+
+#include "AI/SolaraqSquadSubsystem.h"
+#include "AI/SolaraqAIController.h"
+#include "AI/SolaraqThreatMapSubsystem.h"
+#include "Pawns/SolaraqEnemyShip.h"
+#include "Engine/World.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqSquadSubsystem* USolaraqSquadSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqSquadSubsystem>() : nullptr;
+}
+
+bool USolaraqSquadSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqSquadSubsystem::Deinitialize()
+{
+    RegisteredMembers.Empty();
+    Squads.Empty();
+    Super::Deinitialize();
+}
+
+TStatId USolaraqSquadSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqSquadSubsystem, STATGROUP_Tickables);
+}
+
+void USolaraqSquadSubsystem::RegisterMember(ASolaraqAIController* Controller)
+{
+    if (Controller)
+    {
+        RegisteredMembers.AddUnique(Controller);
+    }
+}
+
+void USolaraqSquadSubsystem::UnregisterMember(ASolaraqAIController* Controller)
+{
+    RegisteredMembers.RemoveSingleSwap(Controller);
+}
+
+void USolaraqSquadSubsystem::Tick(float DeltaTime)
+{
+    TimeUntilUpdate -= DeltaTime;
+    if (TimeUntilUpdate > 0.0f)
+    {
+        return;
+    }
+    TimeUntilUpdate = SquadUpdateInterval;
+
+    FormSquads();
+    for (const FSquad& Squad : Squads)
+    {
+        AssignTargets(Squad);
+    }
+}
+
+void USolaraqSquadSubsystem::FormSquads()
+{
+    Squads.Reset();
+
+    // Collect live members (and drop dead weak pointers while we're at it)
+    TArray<ASolaraqAIController*> Unassigned;
+    Unassigned.Reserve(RegisteredMembers.Num());
+    for (int32 Index = RegisteredMembers.Num() - 1; Index >= 0; --Index)
+    {
+        ASolaraqAIController* Controller = RegisteredMembers[Index].Get();
+        if (!Controller)
+        {
+            RegisteredMembers.RemoveAtSwap(Index);
+            continue;
+        }
+        const ASolaraqEnemyShip* Ship = Controller->GetControlledEnemyShip();
+        if (Ship && !Ship->IsDead())
+        {
+            Unassigned.Add(Controller);
+        }
+    }
+
+    // Greedy proximity clustering: seed a squad with the first free ship, pull in same-team ships around it
+    const float SquadRadiusSq = FMath::Square(SquadRadius);
+    while (Unassigned.Num() > 0)
+    {
+        FSquad& Squad = Squads.AddDefaulted_GetRef();
+        ASolaraqAIController* Seed = Unassigned.Pop(EAllowShrinking::No);
+        Squad.Members.Add(Seed);
+        Squad.TeamId = Seed->GetGenericTeamId();
+        const FVector SeedLocation = Seed->GetControlledEnemyShip()->GetActorLocation();
+
+        for (int32 Index = Unassigned.Num() - 1; Index >= 0 && Squad.Members.Num() < MaxSquadSize; --Index)
+        {
+            ASolaraqAIController* Candidate = Unassigned[Index];
+            if (Candidate->GetGenericTeamId() == Squad.TeamId &&
+                FVector::DistSquared(SeedLocation, Candidate->GetControlledEnemyShip()->GetActorLocation()) <= SquadRadiusSq)
+            {
+                Squad.Members.Add(Candidate);
+                Unassigned.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+            }
+        }
+    }
+}
+
+float USolaraqSquadSubsystem::GetThreat(const ASolaraqShipBase* Target) const
+{
+    float Threat = 1.0f;
+    if (Target->IsPlayerControlled())
+    {
+        Threat += PlayerThreatBonus;
+    }
+    Threat += WoundedThreatBonus * (1.0f - Target->GetHealthPercentage());
+    return Threat;
+}
+
+void USolaraqSquadSubsystem::AssignTargets(const FSquad& Squad)
+{
+    // --- Pool everything the squad can see ---
+    TArray<ASolaraqShipBase*, TInlineAllocator<16>> Targets;
+    for (const ASolaraqAIController* Member : Squad.Members)
+    {
+        for (const TWeakObjectPtr<ASolaraqShipBase>& Perceived : Member->GetPerceivedHostiles())
+        {
+            ASolaraqShipBase* Target = Perceived.Get();
+            if (Target && !Target->IsDead())
+            {
+                Targets.AddUnique(Target);
+            }
+        }
+    }
+
+    if (Targets.Num() == 0)
+    {
+        for (ASolaraqAIController* Member : Squad.Members)
+        {
+            Member->ClearSquadOrders();
+        }
+        return;
+    }
+
+    // --- Greedy assignment over (member, target) pairs sorted by cost ---
+    struct FCandidatePair
+    {
+        int32 MemberIndex;
+        int32 TargetIndex;
+        float Cost;
+    };
+
+    // Targets sitting deep in hostile-held space are more expensive to reach
+    const USolaraqThreatMapSubsystem* ThreatMap = USolaraqThreatMapSubsystem::Get(this);
+    TArray<float, TInlineAllocator<16>> Threats;
+    TArray<float, TInlineAllocator<16>> DangerScales;
+    for (const ASolaraqShipBase* Target : Targets)
+    {
+        Threats.Add(GetThreat(Target));
+        const float Danger = ThreatMap ? ThreatMap->GetThreat(Squad.TeamId, Target->GetActorLocation()) : 0.0f;
+        DangerScales.Add(1.0f + TargetAreaDangerWeight * Danger);
+    }
+
+    TArray<FCandidatePair, TInlineAllocator<64>> Pairs;
+    for (int32 MemberIndex = 0; MemberIndex < Squad.Members.Num(); ++MemberIndex)
+    {
+        const FVector MemberLocation = Squad.Members[MemberIndex]->GetControlledEnemyShip()->GetActorLocation();
+        for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+        {
+            const float Distance = FVector::Dist(MemberLocation, Targets[TargetIndex]->GetActorLocation());
+            Pairs.Add({ MemberIndex, TargetIndex, Distance * DangerScales[TargetIndex] / Threats[TargetIndex] });
+        }
+    }
+    Pairs.Sort([](const FCandidatePair& A, const FCandidatePair& B) { return A.Cost < B.Cost; });
+
+    // If we outnumber the targets, let the cap grow so nobody sits idle
+    const int32 AttackerCap = FMath::Max(MaxAttackersPerTarget, FMath::DivideAndRoundUp(Squad.Members.Num(), Targets.Num()));
+
+    TArray<int32, TInlineAllocator<8>> MemberTarget;
+    MemberTarget.Init(INDEX_NONE, Squad.Members.Num());
+    TArray<int32, TInlineAllocator<16>> TargetLoad;
+    TargetLoad.Init(0, Targets.Num());
+
+    int32 NumAssigned = 0;
+    for (const FCandidatePair& Pair : Pairs)
+    {
+        if (MemberTarget[Pair.MemberIndex] != INDEX_NONE || TargetLoad[Pair.TargetIndex] >= AttackerCap)
+        {
+            continue;
+        }
+        MemberTarget[Pair.MemberIndex] = Pair.TargetIndex;
+        ++TargetLoad[Pair.TargetIndex];
+        if (++NumAssigned == Squad.Members.Num())
+        {
+            break;
+        }
+    }
+
+    // --- Push orders; members sharing a target alternate offset sides so they pincer instead of stacking ---
+    TArray<int32, TInlineAllocator<16>> SideCounter;
+    SideCounter.Init(0, Targets.Num());
+    for (int32 MemberIndex = 0; MemberIndex < Squad.Members.Num(); ++MemberIndex)
+    {
+        const int32 TargetIndex = MemberTarget[MemberIndex];
+        if (TargetIndex == INDEX_NONE)
+        {
+            Squad.Members[MemberIndex]->ClearSquadOrders();
+            continue;
+        }
+        const int32 OffsetSide = (SideCounter[TargetIndex]++ % 2 == 0) ? 1 : -1;
+        Squad.Members[MemberIndex]->ApplySquadOrders(Targets[TargetIndex], OffsetSide);
+    }
+
+    UE_LOG(LogSolaraqAI, Verbose, TEXT("Squad (Team %d, %d members): assigned %d members over %d targets."),
+        Squad.TeamId.GetId(), Squad.Members.Num(), NumAssigned, Targets.Num());
+}
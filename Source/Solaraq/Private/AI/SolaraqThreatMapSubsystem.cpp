@@ -0,0 +1,225 @@
+// SolaraqThreatMapSubsystem.cpp
+
+#include "AI/SolaraqThreatMapSubsystem.h"
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h"
+#include "Environment/CelestialBodyBase.h"
+#include "Pawns/SolaraqShipBase.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqThreatMapSubsystem* USolaraqThreatMapSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqThreatMapSubsystem>() : nullptr;
+}
+
+bool USolaraqThreatMapSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqThreatMapSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    if (InWorld.GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    // Gravity wells are static hazards; stamp them once.
+    // Bodies haven't begun play yet, so the radius has to come from GetInfluenceDistance (not a BeginPlay cache).
+    int32 NumHazards = 0;
+    for (TActorIterator<ACelestialBodyBase> It(&InWorld); It; ++It)
+    {
+        const float InfluenceDistance = It->GetInfluenceDistance();
+        if (InfluenceDistance > 0.0f)
+        {
+            Stamp(GetCell(It->GetActorLocation()), InfluenceDistance, CelestialHazardStrength, INDEX_NONE, 1.0f);
+            ++NumHazards;
+        }
+        else
+        {
+            UE_LOG(LogSolaraqAI, Warning, TEXT("ThreatMap: %s has no influence radius, not stamped as a hazard."), *It->GetName());
+        }
+    }
+
+    UE_LOG(LogSolaraqAI, Log, TEXT("ThreatMap: Stamped %d celestial hazards (%d cells)."), NumHazards, Cells.Num());
+}
+
+void USolaraqThreatMapSubsystem::Deinitialize()
+{
+    Cells.Empty();
+    Sources.Empty();
+    Super::Deinitialize();
+}
+
+TStatId USolaraqThreatMapSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqThreatMapSubsystem, STATGROUP_Tickables);
+}
+
+FIntPoint USolaraqThreatMapSubsystem::GetCell(const FVector& Location) const
+{
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// --- Sources ---
+
+int32 USolaraqThreatMapSubsystem::RegisterSource(const AActor* Source, float Range, float Strength)
+{
+    if (!Source)
+    {
+        return INDEX_NONE;
+    }
+
+    FSource NewSource;
+    NewSource.Actor = Source;
+    NewSource.Range = Range > 0.0f ? Range : DefaultSourceRange;
+    NewSource.Strength = Strength;
+    return Sources.Add(MoveTemp(NewSource)); // Stamped on the next update
+}
+
+void USolaraqThreatMapSubsystem::UnregisterSource(int32& Handle)
+{
+    if (Sources.IsValidIndex(Handle))
+    {
+        Unstamp(Sources[Handle]);
+        Sources.RemoveAt(Handle);
+    }
+    Handle = INDEX_NONE;
+}
+
+void USolaraqThreatMapSubsystem::Stamp(const FIntPoint& Center, float Range, float Strength, int32 Layer, float Sign)
+{
+    if (Strength <= 0.0f || Range <= 0.0f)
+    {
+        return;
+    }
+
+    const int32 Reach = FMath::CeilToInt32(Range / CellSize);
+    for (int32 X = -Reach; X <= Reach; ++X)
+    {
+        for (int32 Y = -Reach; Y <= Reach; ++Y)
+        {
+            // Cell-centre distance keeps stamp and unstamp bit-identical no matter where inside the cell the source is
+            const float Distance = FMath::Sqrt(static_cast<float>(X * X + Y * Y)) * CellSize;
+            const float Falloff = 1.0f - Distance / Range;
+            if (Falloff <= 0.0f)
+            {
+                continue;
+            }
+
+            FCell& Cell = Cells.FindOrAdd(FIntPoint(Center.X + X, Center.Y + Y));
+            float& Value = (Layer == INDEX_NONE) ? Cell.Hazard : Cell.TeamInfluence[Layer];
+            Value += Sign * Strength * Falloff;
+        }
+    }
+}
+
+void USolaraqThreatMapSubsystem::Unstamp(FSource& Source)
+{
+    if (Source.bStamped)
+    {
+        Stamp(Source.StampedCell, Source.Range, Source.StampedStrength, Source.StampedLayer, -1.0f);
+        Source.bStamped = false;
+    }
+}
+
+void USolaraqThreatMapSubsystem::Tick(float DeltaTime)
+{
+    TimeUntilUpdate -= DeltaTime;
+    if (TimeUntilUpdate > 0.0f)
+    {
+        return;
+    }
+    TimeUntilUpdate = UpdateInterval;
+
+    const USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this);
+
+    TArray<int32, TInlineAllocator<16>> Removed;
+    for (auto It = Sources.CreateIterator(); It; ++It)
+    {
+        FSource& Source = *It;
+        const AActor* Actor = Source.Actor.Get();
+        if (!Actor)
+        {
+            Unstamp(Source);
+            Removed.Add(It.GetIndex());
+            continue;
+        }
+
+        // Dead ships project nothing; team can change with possession
+        const ASolaraqShipBase* Ship = Cast<ASolaraqShipBase>(Actor);
+        const float Strength = (Ship && Ship->IsDead()) ? 0.0f : Source.Strength;
+        const FGenericTeamId TeamId = Teams ? Teams->FindTeamId(*Actor) : FGenericTeamId::GetTeamIdentifier(Actor);
+        const int32 Layer = TeamId.GetId();
+        const FIntPoint Cell = GetCell(Actor->GetActorLocation());
+
+        const bool bShouldStamp = Strength > 0.0f && Layer < MaxTeamLayers;
+        const bool bUnchanged = Source.bStamped == bShouldStamp &&
+            (!bShouldStamp || (Source.StampedCell == Cell && Source.StampedLayer == Layer && Source.StampedStrength == Strength));
+        if (bUnchanged)
+        {
+            continue;
+        }
+
+        Unstamp(Source);
+        if (bShouldStamp)
+        {
+            Stamp(Cell, Source.Range, Strength, Layer, 1.0f);
+            Source.bStamped = true;
+            Source.StampedCell = Cell;
+            Source.StampedLayer = Layer;
+            Source.StampedStrength = Strength;
+        }
+    }
+
+    for (const int32 Index : Removed)
+    {
+        Sources.RemoveAt(Index);
+    }
+}
+
+// --- Queries ---
+
+float USolaraqThreatMapSubsystem::GetCellThreat(FGenericTeamId ForTeam, const FIntPoint& CellCoord) const
+{
+    const FCell* Cell = Cells.Find(CellCoord);
+    if (!Cell)
+    {
+        return 0.0f;
+    }
+
+    const USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this);
+    float Threat = Cell->Hazard;
+    for (int32 Layer = 0; Layer < MaxTeamLayers; ++Layer)
+    {
+        if (Cell->TeamInfluence[Layer] <= KINDA_SMALL_NUMBER)
+        {
+            continue; // Also swallows float residue left by stamp/unstamp
+        }
+        const FGenericTeamId LayerTeam(static_cast<uint8>(Layer));
+        const bool bHostile = Teams ? Teams->GetAttitude(LayerTeam, ForTeam) == ETeamAttitude::Hostile : LayerTeam != ForTeam;
+        if (bHostile)
+        {
+            Threat += Cell->TeamInfluence[Layer];
+        }
+    }
+    return FMath::Max(Threat, 0.0f);
+}
+
+float USolaraqThreatMapSubsystem::GetThreat(FGenericTeamId ForTeam, const FVector& Location) const
+{
+    return GetCellThreat(ForTeam, GetCell(Location));
+}
+
+FVector USolaraqThreatMapSubsystem::GetRetreatDirection(FGenericTeamId ForTeam, const FVector& Location) const
+{
+    // Central differences over the neighbouring cells
+    const FIntPoint Cell = GetCell(Location);
+    const float GradientX = GetCellThreat(ForTeam, Cell + FIntPoint(1, 0)) - GetCellThreat(ForTeam, Cell - FIntPoint(1, 0));
+    const float GradientY = GetCellThreat(ForTeam, Cell + FIntPoint(0, 1)) - GetCellThreat(ForTeam, Cell - FIntPoint(0, 1));
+    return FVector(-GradientX, -GradientY, 0.0f).GetSafeNormal();
+}
@@ -0,0 +1,229 @@
+// SolaraqTurretTargetingSubsystem.cpp
+
+#include "AI/SolaraqTurretTargetingSubsystem.h"
+#include "AI/SolaraqAIController.h"
+#include "AI/SolaraqLineOfSightSubsystem.h"
+#include "Components/SolaraqGimbalGunComponent.h"
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h"
+#include "Pawns/SolaraqShipBase.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqTurretTargetingSubsystem* USolaraqTurretTargetingSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqTurretTargetingSubsystem>() : nullptr;
+}
+
+bool USolaraqTurretTargetingSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqTurretTargetingSubsystem::Deinitialize()
+{
+    Turrets.Empty();
+    Candidates.Empty();
+    CandidateCells.Empty();
+    Super::Deinitialize();
+}
+
+TStatId USolaraqTurretTargetingSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqTurretTargetingSubsystem, STATGROUP_Tickables);
+}
+
+FIntPoint USolaraqTurretTargetingSubsystem::GetCell(const FVector& Location) const
+{
+    return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+// --- Registration ---
+
+void USolaraqTurretTargetingSubsystem::RegisterTurret(USolaraqGimbalGunComponent* Gun)
+{
+    if (Gun && !Turrets.ContainsByPredicate([Gun](const FTurret& Turret) { return Turret.Gun == Gun; }))
+    {
+        FTurret& Turret = Turrets.AddDefaulted_GetRef();
+        Turret.Gun = Gun;
+    }
+}
+
+void USolaraqTurretTargetingSubsystem::UnregisterTurret(USolaraqGimbalGunComponent* Gun)
+{
+    const int32 Index = Turrets.IndexOfByPredicate([Gun](const FTurret& Turret) { return Turret.Gun == Gun; });
+    if (Index != INDEX_NONE)
+    {
+        Turrets.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+}
+
+// --- Shared spatial snapshot ---
+
+void USolaraqTurretTargetingSubsystem::RebuildSnapshot()
+{
+    Candidates.Reset();
+    for (TPair<FIntPoint, TArray<int32>>& Cell : CandidateCells)
+    {
+        Cell.Value.Reset();
+    }
+
+    const USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this);
+    for (TActorIterator<ASolaraqShipBase> It(GetWorld()); It; ++It)
+    {
+        ASolaraqShipBase* Ship = *It;
+        if (Ship->IsDead())
+        {
+            continue;
+        }
+
+        FCandidate& Candidate = Candidates.AddDefaulted_GetRef();
+        Candidate.Ship = Ship;
+        Candidate.Location = Ship->GetActorLocation();
+        Candidate.TeamId = Teams ? Teams->FindTeamId(*Ship) : FGenericTeamId::GetTeamIdentifier(Ship);
+        CandidateCells.FindOrAdd(GetCell(Candidate.Location)).Add(Candidates.Num() - 1);
+    }
+}
+
+ASolaraqShipBase* USolaraqTurretTargetingSubsystem::FindTarget(const USolaraqGimbalGunComponent& Gun) const
+{
+    const AActor* Owner = Gun.GetOwner();
+    const USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this);
+    USolaraqLineOfSightSubsystem* LineOfSight = USolaraqLineOfSightSubsystem::Get(this);
+    const FGenericTeamId TurretTeam = Teams ? Teams->FindTeamId(*Owner) : Gun.GetGenericTeamId();
+
+    const FVector GunLocation = Gun.GetComponentLocation();
+    const float Range = Gun.AutonomousTargetRange;
+    const FIntPoint MinCell = GetCell(GunLocation - FVector(Range, Range, 0.0f));
+    const FIntPoint MaxCell = GetCell(GunLocation + FVector(Range, Range, 0.0f));
+
+    ASolaraqShipBase* BestTarget = nullptr;
+    float BestDistSq = FMath::Square(Range);
+    for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+    {
+        for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+        {
+            const TArray<int32>* Cell = CandidateCells.Find(FIntPoint(X, Y));
+            if (!Cell)
+            {
+                continue;
+            }
+
+            for (const int32 CandidateIndex : *Cell)
+            {
+                const FCandidate& Candidate = Candidates[CandidateIndex];
+                const float DistSq = FVector::DistSquared(GunLocation, Candidate.Location);
+                if (DistSq >= BestDistSq)
+                {
+                    continue;
+                }
+
+                // Destroyed or killed since the snapshot was taken
+                ASolaraqShipBase* Ship = Candidate.Ship.Get();
+                if (!Ship || Ship->IsDead() || Ship->GetOwner() == Owner)
+                {
+                    continue;
+                }
+
+                const bool bHostile = Teams ? Teams->GetAttitude(TurretTeam, Candidate.TeamId) == ETeamAttitude::Hostile
+                                            : Candidate.TeamId != TurretTeam;
+                if (!bHostile || !Gun.IsYawWithinConstraints(Gun.GetRelativeYawTo(Candidate.Location)))
+                {
+                    continue;
+                }
+
+                // Unknown = not traced yet, give it the benefit of the doubt like the ship AI does
+                if (LineOfSight && LineOfSight->QueryLineOfSight(Owner, Ship, GunLocation, Candidate.Location) == ESolaraqLineOfSight::Blocked)
+                {
+                    continue;
+                }
+
+                BestDistSq = DistSq;
+                BestTarget = Ship;
+            }
+        }
+    }
+    return BestTarget;
+}
+
+// --- Update ---
+
+void USolaraqTurretTargetingSubsystem::Tick(float DeltaTime)
+{
+    if (Turrets.Num() == 0)
+    {
+        return;
+    }
+
+    TimeUntilSnapshot -= DeltaTime;
+    if (TimeUntilSnapshot <= 0.0f)
+    {
+        RebuildSnapshot();
+        TimeUntilSnapshot = SnapshotInterval;
+    }
+
+    // Token bucket; allow a short burst so turrets serviced in the same frame can all fire
+    const float MaxBurst = FMath::Max(1.0f, MaxShotsPerSecond * 0.25f);
+    FireTokens = FMath::Min(FireTokens + MaxShotsPerSecond * DeltaTime, MaxBurst);
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    const int32 NumUpdates = FMath::Min(MaxTurretUpdatesPerTick, Turrets.Num());
+    for (int32 Update = 0; Update < NumUpdates; ++Update)
+    {
+        Cursor = Cursor % Turrets.Num();
+        UpdateTurret(Turrets[Cursor], Now);
+        ++Cursor;
+    }
+}
+
+void USolaraqTurretTargetingSubsystem::UpdateTurret(FTurret& Turret, double Now)
+{
+    USolaraqGimbalGunComponent* Gun = Turret.Gun;
+    const AActor* Owner = Gun->GetOwner();
+    if (!Owner)
+    {
+        return;
+    }
+
+    ASolaraqShipBase* Target = Turret.Target.Get();
+    if (Target && Target->IsDead())
+    {
+        Target = nullptr;
+    }
+    if (!Target || Now >= Turret.NextReevaluateTime)
+    {
+        Target = FindTarget(*Gun);
+        Turret.Target = Target;
+        Turret.NextReevaluateTime = Now + ReevaluateInterval * FMath::FRandRange(0.75f, 1.25f);
+    }
+    if (!Target)
+    {
+        return;
+    }
+
+    // Lead the target
+    const FVector MuzzleLocation = Gun->GetComponentLocation();
+    const FVector TargetLocation = Target->GetActorLocation();
+    FVector AimLocation = TargetLocation;
+    if (!ASolaraqAIController::CalculateInterceptPoint(MuzzleLocation, Owner->GetVelocity(), TargetLocation,
+        Target->GetVelocity(), Gun->ProjectileMuzzleSpeed, AimLocation))
+    {
+        AimLocation = TargetLocation;
+    }
+
+    // Target slid out of the arc: drop it, the next update searches again
+    if (!Gun->IsYawWithinConstraints(Gun->GetRelativeYawTo(AimLocation)))
+    {
+        Turret.Target = nullptr;
+        Turret.NextReevaluateTime = Now;
+        return;
+    }
+
+    Gun->AimAtWorldLocation(AimLocation);
+
+    if (FireTokens >= 1.0f && Gun->GetAimError() <= Gun->AutonomousFireAngleTolerance && Gun->FireAuthoritative())
+    {
+        FireTokens -= 1.0f;
+    }
+}
@@ -0,0 +1,381 @@
+// SolaraqBenchmarkGameMode.cpp
+
+#include "Benchmark/SolaraqBenchmarkGameMode.h"
+#include "Benchmark/SolaraqBenchmarkStats.h"
+#include "AI/SolaraqAIController.h"
+#include "AI/SolaraqAbstractCombatSubsystem.h"
+#include "Pawns/SolaraqEnemyShip.h"
+#include "Environment/CelestialBodyBase.h"
+#include "Environment/AsteroidFieldGenerator.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformMemory.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Logging/SolaraqLogChannels.h"
+
+namespace SolaraqBenchmark
+{
+    FCounters GCounters;
+
+    /** Nearest-rank percentile of an unsorted sample set. */
+    static float Percentile(TArray<float> Samples, float Fraction)
+    {
+        if (Samples.Num() == 0)
+        {
+            return 0.0f;
+        }
+        Samples.Sort();
+        const int32 Rank = FMath::Clamp(FMath::CeilToInt(Fraction * Samples.Num()) - 1, 0, Samples.Num() - 1);
+        return Samples[Rank];
+    }
+
+    static TSharedRef<FJsonObject> MakeTimingObject(const TArray<float>& Samples)
+    {
+        double Sum = 0.0;
+        float Max = 0.0f;
+        for (const float Sample : Samples)
+        {
+            Sum += Sample;
+            Max = FMath::Max(Max, Sample);
+        }
+
+        TSharedRef<FJsonObject> Obj = MakeShared<FJsonObject>();
+        Obj->SetNumberField(TEXT("avg"), Samples.Num() > 0 ? Sum / Samples.Num() : 0.0);
+        Obj->SetNumberField(TEXT("p50"), Percentile(Samples, 0.50f));
+        Obj->SetNumberField(TEXT("p90"), Percentile(Samples, 0.90f));
+        Obj->SetNumberField(TEXT("p99"), Percentile(Samples, 0.99f));
+        Obj->SetNumberField(TEXT("max"), Max);
+        return Obj;
+    }
+
+    static double BytesToMB(uint64 Bytes)
+    {
+        return static_cast<double>(Bytes) / (1024.0 * 1024.0);
+    }
+}
+
+void FSolaraqBenchmarkTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+    if (ASolaraqBenchmarkGameMode* GameMode = Target.Get())
+    {
+        GameMode->OnPhysicsBracketTick(bIsEndOfPhysics);
+    }
+}
+
+ASolaraqBenchmarkGameMode::ASolaraqBenchmarkGameMode()
+{
+    PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = true;
+    // Record after everything else has ticked this frame
+    PrimaryActorTick.TickGroup = TG_PostUpdateWork;
+
+    // Nobody plays in a benchmark
+    DefaultPawnClass = nullptr;
+    AIControllerClass = ASolaraqAIController::StaticClass();
+
+    StartPhysicsTick.TickGroup = TG_StartPhysics;
+    StartPhysicsTick.bCanEverTick = true;
+    StartPhysicsTick.bStartWithTickEnabled = true;
+    StartPhysicsTick.bIsEndOfPhysics = false;
+
+    EndPhysicsTick.TickGroup = TG_EndPhysics;
+    EndPhysicsTick.bCanEverTick = true;
+    EndPhysicsTick.bStartWithTickEnabled = true;
+    EndPhysicsTick.bIsEndOfPhysics = true;
+}
+
+void ASolaraqBenchmarkGameMode::BeginPlay()
+{
+    Super::BeginPlay();
+
+    ParseCommandLineOverrides();
+
+    // Fixed seed for everything that uses the global RNG (AI offset sides, fire rate jitter...)
+    FMath::RandInit(RandomSeed);
+    FMath::SRandInit(RandomSeed);
+    SolaraqBenchmark::GCounters.Reset();
+
+    // Headless runs have no players, so abstract combat would collapse every fight we're trying to measure
+    if (USolaraqAbstractCombatSubsystem* AbstractCombat = USolaraqAbstractCombatSubsystem::Get(this))
+    {
+        AbstractCombat->SetEnabled(false);
+    }
+
+    StartPhysicsTick.Target = this;
+    EndPhysicsTick.Target = this;
+    StartPhysicsTick.RegisterTickFunction(GetLevel());
+    EndPhysicsTick.RegisterTickFunction(GetLevel());
+
+    SpawnTeams();
+
+    const int32 ExpectedFrames = FMath::CeilToInt(DurationSeconds * 120.0f);
+    GameThreadMs.Reserve(ExpectedFrames);
+    PhysicsWindowMs.Reserve(ExpectedFrames);
+    AIMs.Reserve(ExpectedFrames);
+    LiveProjectileSamples.Reserve(ExpectedFrames);
+
+    MemoryUsedAtStart = FPlatformMemory::GetStats().UsedPhysical;
+    PeakMemoryUsed = MemoryUsedAtStart;
+    bRunning = true;
+
+    UE_LOG(LogSolaraqSystem, Display, TEXT("Benchmark started: %d ships per team, %.1fs (+%.1fs warmup), seed %d."),
+        ShipsPerTeam, DurationSeconds, WarmupSeconds, RandomSeed);
+}
+
+void ASolaraqBenchmarkGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    StartPhysicsTick.UnRegisterTickFunction();
+    EndPhysicsTick.UnRegisterTickFunction();
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASolaraqBenchmarkGameMode::ParseCommandLineOverrides()
+{
+    const TCHAR* CmdLine = FCommandLine::Get();
+
+    FParse::Value(CmdLine, TEXT("BenchShips="), ShipsPerTeam);
+    FParse::Value(CmdLine, TEXT("BenchSeconds="), DurationSeconds);
+    FParse::Value(CmdLine, TEXT("BenchWarmup="), WarmupSeconds);
+    FParse::Value(CmdLine, TEXT("BenchSeed="), RandomSeed);
+    FParse::Value(CmdLine, TEXT("BenchOut="), ReportPathOverride);
+    FParse::Value(CmdLine, TEXT("BenchLabel="), RunLabel);
+
+    FString ShipClassPath;
+    if (FParse::Value(CmdLine, TEXT("BenchShipClass="), ShipClassPath))
+    {
+        ShipClass = TSoftClassPtr<ASolaraqEnemyShip>(FSoftObjectPath(ShipClassPath));
+    }
+
+    ShipsPerTeam = FMath::Max(1, ShipsPerTeam);
+    DurationSeconds = FMath::Max(1.0f, DurationSeconds);
+}
+
+void ASolaraqBenchmarkGameMode::SpawnTeams()
+{
+    UClass* ResolvedShipClass = ShipClass.IsNull() ? nullptr : ShipClass.LoadSynchronous();
+    if (!ResolvedShipClass)
+    {
+        UE_LOG(LogSolaraqSystem, Warning, TEXT("Benchmark: No ShipClass configured, spawning bare ASolaraqEnemyShip (no weapons/meshes)."));
+        ResolvedShipClass = ASolaraqEnemyShip::StaticClass();
+    }
+
+    // --- Gather anchors: the fight happens around the map's celestial bodies and asteroid belts ---
+    TArray<FVector> Anchors;
+    for (TActorIterator<ACelestialBodyBase> It(GetWorld()); It; ++It)
+    {
+        Anchors.Add(It->GetActorLocation());
+    }
+    for (TActorIterator<AAsteroidFieldGenerator> It(GetWorld()); It; ++It)
+    {
+        Anchors.Add(It->GetActorLocation());
+    }
+    if (Anchors.Num() == 0)
+    {
+        Anchors.Add(FVector::ZeroVector);
+    }
+
+    // Actor iteration order is stable for a given map, so the stream gives reproducible placement
+    FRandomStream Stream(RandomSeed);
+
+    for (int32 Index = 0; Index < ShipsPerTeam; ++Index)
+    {
+        const FVector& Anchor = Anchors[Index % Anchors.Num()];
+        const float Angle = Stream.FRandRange(0.0f, 2.0f * PI);
+        const FVector RingDir(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f);
+
+        // Team A on one side of the anchor, team B mirrored on the other side, both facing inward
+        for (int32 Side = 0; Side < 2; ++Side)
+        {
+            const FVector Dir = Side == 0 ? RingDir : -RingDir;
+            FVector Jitter = Stream.GetUnitVector() * Stream.FRandRange(0.0f, SpawnJitter);
+            Jitter.Z = 0.0f;
+
+            const FVector Location = Anchor + Dir * SpawnRingRadius + Jitter;
+            const FRotator Rotation = (-Dir).Rotation();
+            const uint8 Team = Side == 0 ? TeamAId : TeamBId;
+
+            if (ASolaraqEnemyShip* Ship = SpawnBenchmarkShip(ResolvedShipClass, Location, Rotation, Team))
+            {
+                (Side == 0 ? TeamAShips : TeamBShips).Add(Ship);
+            }
+        }
+    }
+
+    UE_LOG(LogSolaraqSystem, Display, TEXT("Benchmark: Spawned %d + %d ships around %d anchors."), TeamAShips.Num(), TeamBShips.Num(), Anchors.Num());
+}
+
+ASolaraqEnemyShip* ASolaraqBenchmarkGameMode::SpawnBenchmarkShip(UClass* InShipClass, const FVector& Location, const FRotator& Rotation, uint8 InTeamId)
+{
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    ASolaraqEnemyShip* Ship = GetWorld()->SpawnActor<ASolaraqEnemyShip>(InShipClass, Location, Rotation, SpawnParams);
+    if (!Ship)
+    {
+        UE_LOG(LogSolaraqSystem, Error, TEXT("Benchmark: Failed to spawn ship at %s"), *Location.ToString());
+        return nullptr;
+    }
+    Ship->SetGenericTeamId(FGenericTeamId(InTeamId));
+
+    // Ship classes with AutoPossessAI already have a controller by now. Keep it if it's the class we want,
+    // otherwise get rid of it so it isn't left orphaned when ours possesses the ship.
+    UClass* DesiredControllerClass = AIControllerClass ? AIControllerClass.Get() : ASolaraqAIController::StaticClass();
+    if (AController* ExistingController = Ship->GetController())
+    {
+        ASolaraqAIController* AutoController = Cast<ASolaraqAIController>(ExistingController);
+        if (AutoController && AutoController->IsA(DesiredControllerClass))
+        {
+            AutoController->SetGenericTeamId(FGenericTeamId(InTeamId)); // Refreshes the team registry
+            return Ship;
+        }
+        ExistingController->UnPossess();
+        ExistingController->Destroy();
+    }
+
+    if (ASolaraqAIController* Controller = GetWorld()->SpawnActor<ASolaraqAIController>(DesiredControllerClass))
+    {
+        Controller->SetGenericTeamId(FGenericTeamId(InTeamId));
+        Controller->Possess(Ship);
+    }
+    return Ship;
+}
+
+void ASolaraqBenchmarkGameMode::OnPhysicsBracketTick(bool bIsEndOfPhysics)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (!bIsEndOfPhysics)
+    {
+        PhysicsWindowStart = Now;
+
+        // AI controllers tick in TG_PrePhysics, so by now this frame's AI work is complete
+        LastAISeconds = SolaraqBenchmark::GCounters.AISeconds;
+        SolaraqBenchmark::GCounters.AISeconds = 0.0;
+    }
+    else
+    {
+        LastPhysicsWindowSeconds = Now - PhysicsWindowStart;
+    }
+}
+
+void ASolaraqBenchmarkGameMode::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    if (!bRunning)
+    {
+        return;
+    }
+
+    ElapsedSeconds += DeltaSeconds;
+    if (ElapsedSeconds > WarmupSeconds)
+    {
+        RecordFrame(DeltaSeconds);
+    }
+
+    if (ElapsedSeconds >= WarmupSeconds + DurationSeconds)
+    {
+        FinishBenchmark();
+    }
+}
+
+void ASolaraqBenchmarkGameMode::RecordFrame(float DeltaSeconds)
+{
+    // GGameThreadTime is last frame's game thread time, which is what we want for a steady-state sample
+    GameThreadMs.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+    PhysicsWindowMs.Add(static_cast<float>(LastPhysicsWindowSeconds * 1000.0));
+    AIMs.Add(static_cast<float>(LastAISeconds * 1000.0));
+    LiveProjectileSamples.Add(SolaraqBenchmark::GCounters.LiveProjectiles);
+
+    PeakMemoryUsed = FMath::Max<uint64>(PeakMemoryUsed, FPlatformMemory::GetStats().UsedPhysical);
+}
+
+FString ASolaraqBenchmarkGameMode::GetReportPath() const
+{
+    if (!ReportPathOverride.IsEmpty())
+    {
+        return ReportPathOverride;
+    }
+    return FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("Benchmark_%s.json"), *FDateTime::Now().ToString());
+}
+
+void ASolaraqBenchmarkGameMode::FinishBenchmark()
+{
+    bRunning = false;
+
+    int32 PeakLive = 0;
+    double LiveSum = 0.0;
+    for (const int32 Live : LiveProjectileSamples)
+    {
+        PeakLive = FMath::Max(PeakLive, Live);
+        LiveSum += Live;
+    }
+
+    auto CountAlive = [](const TArray<TWeakObjectPtr<ASolaraqEnemyShip>>& Ships)
+    {
+        int32 Alive = 0;
+        for (const TWeakObjectPtr<ASolaraqEnemyShip>& Ship : Ships)
+        {
+            Alive += (Ship.IsValid() && !Ship->IsDead()) ? 1 : 0;
+        }
+        return Alive;
+    };
+
+    const uint64 MemoryUsedAtEnd = FPlatformMemory::GetStats().UsedPhysical;
+
+    // --- Build Report ---
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetStringField(TEXT("label"), RunLabel);
+    Root->SetStringField(TEXT("map"), GetWorld()->GetMapName());
+    Root->SetNumberField(TEXT("seed"), RandomSeed);
+    Root->SetNumberField(TEXT("ships_per_team"), ShipsPerTeam);
+    Root->SetNumberField(TEXT("duration_seconds"), DurationSeconds);
+    Root->SetNumberField(TEXT("frames"), GameThreadMs.Num());
+
+    TSharedRef<FJsonObject> Timings = MakeShared<FJsonObject>();
+    Timings->SetObjectField(TEXT("game_thread_ms"), SolaraqBenchmark::MakeTimingObject(GameThreadMs));
+    Timings->SetObjectField(TEXT("physics_window_ms"), SolaraqBenchmark::MakeTimingObject(PhysicsWindowMs)); // Game thread, not solver time
+    Timings->SetObjectField(TEXT("ai_ms"), SolaraqBenchmark::MakeTimingObject(AIMs));
+    Root->SetObjectField(TEXT("timings"), Timings);
+
+    TSharedRef<FJsonObject> Projectiles = MakeShared<FJsonObject>();
+    Projectiles->SetNumberField(TEXT("spawned_total"), static_cast<double>(SolaraqBenchmark::GCounters.ProjectilesSpawned));
+    Projectiles->SetNumberField(TEXT("peak_live"), PeakLive);
+    Projectiles->SetNumberField(TEXT("avg_live"), LiveProjectileSamples.Num() > 0 ? LiveSum / LiveProjectileSamples.Num() : 0.0);
+    Root->SetObjectField(TEXT("projectiles"), Projectiles);
+
+    TSharedRef<FJsonObject> Survivors = MakeShared<FJsonObject>();
+    Survivors->SetNumberField(TEXT("team_a"), CountAlive(TeamAShips));
+    Survivors->SetNumberField(TEXT("team_b"), CountAlive(TeamBShips));
+    Root->SetObjectField(TEXT("survivors"), Survivors);
+
+    TSharedRef<FJsonObject> Memory = MakeShared<FJsonObject>();
+    Memory->SetNumberField(TEXT("start_used_mb"), SolaraqBenchmark::BytesToMB(MemoryUsedAtStart));
+    Memory->SetNumberField(TEXT("peak_used_mb"), SolaraqBenchmark::BytesToMB(PeakMemoryUsed));
+    Memory->SetNumberField(TEXT("end_used_mb"), SolaraqBenchmark::BytesToMB(MemoryUsedAtEnd));
+    Root->SetObjectField(TEXT("memory"), Memory);
+
+    FString Output;
+    const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+    FJsonSerializer::Serialize(Root, Writer);
+
+    const FString ReportPath = GetReportPath();
+    if (FFileHelper::SaveStringToFile(Output, *ReportPath))
+    {
+        UE_LOG(LogSolaraqSystem, Display, TEXT("Benchmark finished. Report written to %s"), *ReportPath);
+    }
+    else
+    {
+        UE_LOG(LogSolaraqSystem, Error, TEXT("Benchmark finished but failed to write report to %s"), *ReportPath);
+    }
+
+    if (bExitWhenDone)
+    {
+        FPlatformMisc::RequestExit(false);
+    }
+}
@@ -8,6 +8,7 @@
 #include "Components/BoxComponent.h"      // To check ship's root comp type
 #include "GameFramework/Actor.h"           // For GetOwner()
 #include "Net/UnrealNetwork.h"
+#include "Network/SolaraqPushModel.h"
 #include "Logging/SolaraqLogChannels.h"    // Optional logging
 
 UDockingPadComponent::UDockingPadComponent()
@@ -107,6 +108,8 @@ bool UDockingPadComponent::InitiateDocking(ASolaraqShipBase* ShipToDock)
         // Set state immediately (will replicate)
         CurrentDockingStatus = EDockingStatus::Occupied; // Or EDockingStatus::Docking if using intermediate states
         CurrentDockedShip = ShipToDock;
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(UDockingPadComponent, CurrentDockingStatus, this);
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(UDockingPadComponent, CurrentDockedShip, this);
 
         // Tell the SHIP to perform the actual docking procedure
         ShipToDock->Server_DockWithPad(this); // Pass self as the pad reference
@@ -144,6 +147,8 @@ bool UDockingPadComponent::InitiateUndocking()
         // Clear local references AFTER telling ship (ship might need pad info during undock)
         CurrentDockingStatus = EDockingStatus::Available; // Or EDockingStatus::Undocking
         CurrentDockedShip = nullptr;
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(UDockingPadComponent, CurrentDockingStatus, this);
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(UDockingPadComponent, CurrentDockedShip, this);
 
         // ForceNetUpdate(); // Optional
 
@@ -161,8 +166,10 @@ void UDockingPadComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    DOREPLIFETIME(UDockingPadComponent, CurrentDockingStatus);
-    DOREPLIFETIME(UDockingPadComponent, CurrentDockedShip);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true; // Marked dirty in InitiateDocking / InitiateUndocking
+    DOREPLIFETIME_WITH_PARAMS_FAST(UDockingPadComponent, CurrentDockingStatus, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(UDockingPadComponent, CurrentDockedShip, Params);
 }
 
 void UDockingPadComponent::OnRep_DockingStatus()
@@ -0,0 +1,190 @@
+// SolaraqBeamSubsystem.cpp
+
+#include "Components/SolaraqBeamSubsystem.h"
+#include "Components/SolaraqBeamWeaponComponent.h"
+#include "Gameplay/Combat/SolaraqDamageSubsystem.h"
+#include "Gameplay/Combat/SolaraqLagCompensationSubsystem.h"
+#include "Gameplay/SolaraqCollisionChannels.h"
+#include "Pawns/SolaraqShipBase.h"
+#include "Engine/World.h"
+#include "GameFramework/DamageType.h"
+
+USolaraqBeamSubsystem* USolaraqBeamSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqBeamSubsystem>() : nullptr;
+}
+
+bool USolaraqBeamSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqBeamSubsystem::Deinitialize()
+{
+    for (USolaraqBeamWeaponComponent* Beam : Beams)
+    {
+        Beam->BeamSlot = INDEX_NONE;
+    }
+    Beams.Empty();
+    InFlight.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqBeamSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqBeamSubsystem, STATGROUP_Tickables);
+}
+
+// --- Registration ---
+
+void USolaraqBeamSubsystem::RegisterBeam(USolaraqBeamWeaponComponent* Beam)
+{
+    if (!Beam || Beam->BeamSlot != INDEX_NONE)
+    {
+        return;
+    }
+
+    Beam->BeamSlot = Beams.Add(Beam);
+    Beam->HitActor = nullptr;
+    Beam->DamageAccumulator = 0.0f;
+}
+
+void USolaraqBeamSubsystem::UnregisterBeam(USolaraqBeamWeaponComponent* Beam)
+{
+    if (!Beam || !Beams.IsValidIndex(Beam->BeamSlot) || Beams[Beam->BeamSlot] != Beam)
+    {
+        return;
+    }
+
+    const int32 Slot = Beam->BeamSlot;
+    Beams.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    if (Beams.IsValidIndex(Slot))
+    {
+        Beams[Slot]->BeamSlot = Slot;
+    }
+    Beam->BeamSlot = INDEX_NONE;
+    Beam->HitActor = nullptr;
+}
+
+// --- Update ---
+
+void USolaraqBeamSubsystem::Tick(float DeltaTime)
+{
+    if (Beams.Num() == 0)
+    {
+        return;
+    }
+
+    UWorld* World = GetWorld();
+    if (!TraceDelegate.IsBound())
+    {
+        TraceDelegate.BindUObject(this, &USolaraqBeamSubsystem::OnTraceCompleted);
+    }
+
+    const double Now = World->GetTimeSeconds();
+
+    // Backwards, so a beam switching off swaps with one that was already updated
+    for (int32 Index = Beams.Num() - 1; Index >= 0; --Index)
+    {
+        USolaraqBeamWeaponComponent* Beam = Beams[Index];
+        AActor* Owner = Beam->GetOwner();
+        if (!Owner)
+        {
+            continue;
+        }
+
+        if (Owner->HasAuthority())
+        {
+            if (!Beam->bHoldUntilStopped && Now - Beam->LastSustainTime > Beam->SustainTimeout)
+            {
+                Beam->SetFiring(false); // Unregisters
+                continue;
+            }
+            ApplyBeamDamage(*Beam, DeltaTime);
+        }
+
+        // Next frame's hit
+        const FVector Start = Beam->GetComponentLocation();
+        const FVector End = Start + Beam->GetForwardVector() * Beam->Range;
+        FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SolaraqBeamTrace), false);
+        QueryParams.AddIgnoredActor(Owner);
+
+        // Projectile channel, so the beam passes through what projectiles pass through (influence spheres, pickups).
+        // Multi, because ships only overlap that channel: the nearest overlap or the first block is the hit.
+        const uint32 RequestId = NextRequestId++;
+        World->AsyncLineTraceByChannel(EAsyncTraceType::Multi, Start, End, ECC_SolaraqProjectile, QueryParams,
+            FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, RequestId);
+        InFlight.Add(RequestId, Beam);
+    }
+}
+
+void USolaraqBeamSubsystem::ApplyBeamDamage(USolaraqBeamWeaponComponent& Beam, float DeltaTime)
+{
+    // Fixed-rate damage, independent of frame rate
+    const float TickInterval = 1.0f / Beam.DamageTickRate;
+    Beam.DamageAccumulator += DeltaTime;
+    const int32 NumTicks = FMath::FloorToInt32(Beam.DamageAccumulator / TickInterval);
+    if (NumTicks <= 0)
+    {
+        return;
+    }
+    Beam.DamageAccumulator -= NumTicks * TickInterval;
+
+    AActor* Target = Beam.HitActor.Get();
+    const float Damage = Beam.DamagePerSecond * TickInterval * NumTicks;
+    if (!Target || Damage <= 0.0f)
+    {
+        return;
+    }
+
+    AActor* Owner = Beam.GetOwner();
+    const FVector ShotDirection = Beam.GetForwardVector();
+    const FHitResult Hit(Target, nullptr, Beam.HitLocation, -ShotDirection);
+    USolaraqDamageSubsystem::QueuePointDamage(Target, Damage, Hit, ShotDirection, UDamageType::StaticClass(), Owner->GetInstigatorController(), Owner);
+}
+
+void USolaraqBeamSubsystem::OnTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceData)
+{
+    TWeakObjectPtr<USolaraqBeamWeaponComponent> WeakBeam;
+    if (!InFlight.RemoveAndCopyValue(TraceData.UserData, WeakBeam))
+    {
+        return;
+    }
+
+    USolaraqBeamWeaponComponent* Beam = WeakBeam.Get();
+    if (!Beam || Beam->BeamSlot == INDEX_NONE)
+    {
+        return; // Stopped firing while the trace was in flight
+    }
+
+    const FHitResult* Hit = TraceData.OutHits.Num() > 0 ? &TraceData.OutHits[0] : nullptr; // Sorted by distance
+    Beam->HitActor = Hit ? Hit->GetActor() : nullptr;
+    Beam->HitLocation = Hit ? Hit->ImpactPoint : TraceData.End;
+    float BeamLength = Hit ? Hit->Distance : Beam->Range;
+
+    // Remote players aimed at ships as they were on their screen; favour the shooter if one was in the beam then
+    AActor* Owner = Beam->GetOwner();
+    const USolaraqLagCompensationSubsystem* LagCompensation = USolaraqLagCompensationSubsystem::Get(this);
+    if (Owner && Owner->HasAuthority() && LagCompensation)
+    {
+        const double ViewTime = LagCompensation->GetViewTime(Owner->GetInstigatorController());
+        float RewoundDistance = 0.0f;
+        if (ViewTime < GetWorld()->GetTimeSeconds())
+        {
+            ASolaraqShipBase* RewoundShip = LagCompensation->SegmentTestAtTime(TraceData.Start, TraceData.End, 0.0f, ViewTime, Owner, RewoundDistance);
+            if (RewoundShip && RewoundDistance < BeamLength)
+            {
+                Beam->HitActor = RewoundShip;
+                Beam->HitLocation = TraceData.Start + (TraceData.End - TraceData.Start).GetSafeNormal() * RewoundDistance;
+                BeamLength = RewoundDistance;
+            }
+        }
+    }
+
+    if (!IsRunningDedicatedServer())
+    {
+        Beam->SetBeamLength(BeamLength);
+    }
+}
@@ -0,0 +1,148 @@
+// SolaraqBeamWeaponComponent.cpp
+
+#include "Components/SolaraqBeamWeaponComponent.h"
+#include "Components/SolaraqBeamSubsystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "Net/UnrealNetwork.h"
+
+USolaraqBeamWeaponComponent::USolaraqBeamWeaponComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+
+    BeamMeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("BeamMesh"));
+    BeamMeshComponent->SetupAttachment(this);
+    BeamMeshComponent->SetCollisionProfileName(UCollisionProfile::NoCollision_ProfileName);
+    BeamMeshComponent->SetCastShadow(false);
+    BeamMeshComponent->SetHiddenInGame(true);
+    BeamMeshComponent->SetIsReplicated(false); // Driven by bFiring and the local trace
+
+    SetIsReplicatedByDefault(true);
+}
+
+void USolaraqBeamWeaponComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+    DOREPLIFETIME(USolaraqBeamWeaponComponent, bFiring);
+}
+
+void USolaraqBeamWeaponComponent::BeginPlay()
+{
+    Super::BeginPlay();
+    UpdateBeamRegistration();
+}
+
+void USolaraqBeamWeaponComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USolaraqBeamSubsystem* Beams = USolaraqBeamSubsystem::Get(this))
+    {
+        Beams->UnregisterBeam(this);
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
+USolaraqBeamWeaponComponent* USolaraqBeamWeaponComponent::FindBeamBelow(const USceneComponent* Parent)
+{
+    if (!Parent)
+    {
+        return nullptr;
+    }
+
+    TArray<USceneComponent*> Children;
+    Parent->GetChildrenComponents(true, Children);
+    for (USceneComponent* Child : Children)
+    {
+        if (USolaraqBeamWeaponComponent* Beam = Cast<USolaraqBeamWeaponComponent>(Child))
+        {
+            return Beam;
+        }
+    }
+    return nullptr;
+}
+
+// --- Firing (server) ---
+
+void USolaraqBeamWeaponComponent::SustainFire()
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority())
+    {
+        return;
+    }
+
+    LastSustainTime = GetWorld()->GetTimeSeconds();
+    SetFiring(true);
+}
+
+void USolaraqBeamWeaponComponent::StartFiring()
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority())
+    {
+        return;
+    }
+
+    bHoldUntilStopped = true;
+    SetFiring(true);
+}
+
+void USolaraqBeamWeaponComponent::StopFiring()
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority())
+    {
+        return;
+    }
+
+    bHoldUntilStopped = false;
+    SetFiring(false);
+}
+
+void USolaraqBeamWeaponComponent::SetFiring(bool bNewFiring)
+{
+    if (bFiring != bNewFiring)
+    {
+        bFiring = bNewFiring;
+        UpdateBeamRegistration();
+    }
+}
+
+void USolaraqBeamWeaponComponent::OnRep_Firing()
+{
+    UpdateBeamRegistration();
+}
+
+void USolaraqBeamWeaponComponent::UpdateBeamRegistration()
+{
+    if (!HasBegunPlay())
+    {
+        return;
+    }
+
+    if (USolaraqBeamSubsystem* Beams = USolaraqBeamSubsystem::Get(this))
+    {
+        if (bFiring)
+        {
+            Beams->RegisterBeam(this);
+        }
+        else
+        {
+            Beams->UnregisterBeam(this);
+        }
+    }
+
+    if (BeamMeshComponent)
+    {
+        BeamMeshComponent->SetHiddenInGame(!bFiring);
+        if (bFiring)
+        {
+            SetBeamLength(Range); // Until the first trace comes back
+        }
+    }
+}
+
+void USolaraqBeamWeaponComponent::SetBeamLength(float Length)
+{
+    if (BeamMeshComponent)
+    {
+        BeamMeshComponent->SetRelativeScale3D(FVector(Length / BeamMeshLength, BeamWidthScale, BeamWidthScale));
+    }
+}
@@ -1,15 +1,22 @@
 // SolaraqGimbalGunComponent.cpp
 
 #include "Components/SolaraqGimbalGunComponent.h"
+#include "Components/SolaraqGimbalGunSubsystem.h"
+#include "AI/SolaraqTurretTargetingSubsystem.h"
+#include "Components/SolaraqBeamWeaponComponent.h"
 #include "Pawns/SolaraqShipBase.h" // For casting owner and getting team
+#include "Projectiles/SolaraqHomingMissile.h"
+#include "Projectiles/SolaraqMissileSubsystem.h"
 #include "Projectiles/SolaraqProjectile.h"
 #include "Components/StaticMeshComponent.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PawnMovementComponent.h"
 #include "GameFramework/PlayerController.h" // For getting mouse
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Network/SolaraqPushModel.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Logging/SolaraqLogChannels.h" // Your custom log channel
@@ -21,8 +28,9 @@
 
 USolaraqGimbalGunComponent::USolaraqGimbalGunComponent()
 {
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.TickGroup = TG_PostPhysics; // Tick after physics to get latest positions
+    // Rotation (and the editor constraint arc) is driven by USolaraqGimbalGunSubsystem; the component never ticks
+    PrimaryComponentTick.bCanEverTick = false;
+    bAutoActivate = true;
 
     // --- Create Gun Mesh Sub-Component ---
     GunMeshComponent = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("GunMesh"));
@@ -68,17 +76,97 @@ void USolaraqGimbalGunComponent::BeginPlay()
         GunMeshComponent->SetRelativeRotation(FRotator(0.f, ClientVisualGimbalRelativeYaw, 0.f));
     }
 
+    BeamWeapon = USolaraqBeamWeaponComponent::FindBeamBelow(this);
+
     // Try to get OwningPawn and TeamID if not set explicitly
     if (!OwningPawn.IsValid())
     {
         SetOwningPawn(Cast<APawn>(GetOwner()));
     }
+
+    if (IsActive())
+    {
+        RegisterWithSubsystems();
+    }
+}
+
+void USolaraqGimbalGunComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UnregisterFromSubsystems();
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(AimRpcTimerHandle);
+        World->GetTimerManager().ClearTimer(AimSettleTimerHandle);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void USolaraqGimbalGunComponent::Activate(bool bReset)
+{
+    Super::Activate(bReset);
+
+    if (HasBegunPlay() && IsActive())
+    {
+        RegisterWithSubsystems();
+    }
+}
+
+void USolaraqGimbalGunComponent::Deactivate()
+{
+    Super::Deactivate();
+
+    UnregisterFromSubsystems();
+}
+
+void USolaraqGimbalGunComponent::RegisterWithSubsystems()
+{
+    if (USolaraqGimbalGunSubsystem* Gimbals = USolaraqGimbalGunSubsystem::Get(this))
+    {
+        Gimbals->RegisterGun(this);
+    }
+
+    if (bAutonomousTargeting && GetOwner() && GetOwner()->HasAuthority())
+    {
+        if (USolaraqTurretTargetingSubsystem* Turrets = USolaraqTurretTargetingSubsystem::Get(this))
+        {
+            Turrets->RegisterTurret(this);
+        }
+    }
+}
+
+void USolaraqGimbalGunComponent::UnregisterFromSubsystems()
+{
+    if (USolaraqGimbalGunSubsystem* Gimbals = USolaraqGimbalGunSubsystem::Get(this))
+    {
+        Gimbals->UnregisterGun(this);
+    }
+
+    if (USolaraqTurretTargetingSubsystem* Turrets = USolaraqTurretTargetingSubsystem::Get(this))
+    {
+        Turrets->UnregisterTurret(this);
+    }
+}
+
+void USolaraqGimbalGunComponent::WakeGimbal()
+{
+    if (GimbalSlot != INDEX_NONE)
+    {
+        if (USolaraqGimbalGunSubsystem* Gimbals = USolaraqGimbalGunSubsystem::Get(this))
+        {
+            Gimbals->WakeGun(this);
+        }
+    }
 }
 
 void USolaraqGimbalGunComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME_CONDITION(USolaraqGimbalGunComponent, CurrentActualGimbalRelativeYaw, COND_SkipOwner); // Replicate to non-owners for visuals
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true; // Only dirtied when the send policy above decides to send
+    Params.Condition = COND_SkipOwner; // Replicate to non-owners for visuals
+    DOREPLIFETIME_WITH_PARAMS_FAST(USolaraqGimbalGunComponent, ReplicatedYaw, Params);
 }
 
 void USolaraqGimbalGunComponent::SetOwningPawn(APawn* NewOwningPawn)
@@ -114,131 +202,186 @@ FGenericTeamId USolaraqGimbalGunComponent::GetGenericTeamId() const
     return TeamId;
 }
 
-void USolaraqGimbalGunComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+float USolaraqGimbalGunComponent::GetRelativeYawTo(const FVector& WorldTargetLocation) const
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    const AActor* MyOwner = GetOwner();
+    const FVector DirectionToTargetWorld = (WorldTargetLocation - GetComponentLocation()).GetSafeNormal();
+    if (!MyOwner || DirectionToTargetWorld.IsNearlyZero())
+    {
+        return DesiredGimbalRelativeYaw;
+    }
 
+    // Transform world direction to local space of the parent component (or actor if no parent component)
+    const FQuat ParentRotation = GetAttachParent() ? GetAttachParent()->GetComponentQuat() : MyOwner->GetActorQuat();
+    FVector DirectionToTargetLocalToParent = ParentRotation.UnrotateVector(DirectionToTargetWorld);
+    DirectionToTargetLocalToParent.Z = 0; // Flatten to XY plane relative to parent
+    DirectionToTargetLocalToParent.Normalize();
+
+    // Calculate yaw angle relative to parent's forward
+    return FRotator::NormalizeAxis(FMath::RadiansToDegrees(FMath::Atan2(DirectionToTargetLocalToParent.Y, DirectionToTargetLocalToParent.X)));
+}
+
+bool USolaraqGimbalGunComponent::IsYawWithinConstraints(float RelativeYaw) const
+{
+    return !bEnableYawConstraints
+        || FMath::Abs(FMath::FindDeltaAngleDegrees(ConstraintCenterRelativeYaw, RelativeYaw)) <= MaxYawAngleFromCenter;
+}
+
+float USolaraqGimbalGunComponent::GetAimError() const
+{
+    return FMath::Abs(FMath::FindDeltaAngleDegrees(CurrentActualGimbalRelativeYaw, GetClampedRelativeYaw(DesiredGimbalRelativeYaw)));
+}
+
+void USolaraqGimbalGunComponent::AimAtWorldLocation(const FVector& WorldTargetLocation)
+{
     AActor* MyOwner = GetOwner();
-    if (!MyOwner || !OwningPawn.IsValid()) return;
+    if (!MyOwner) return;
 
-    // --- Server Authoritative Rotation ---
-    if (MyOwner->HasAuthority())
-    {
-        // Server smoothly interpolates its CurrentActualGimbalRelativeYaw towards DesiredGimbalRelativeYaw
-        // DesiredGimbalRelativeYaw is set by Server_SetDesiredYaw (RPC from client) or directly by AI
-        float ClampedDesiredYaw = GetClampedRelativeYaw(DesiredGimbalRelativeYaw);
+    if ((WorldTargetLocation - GetComponentLocation()).IsNearlyZero()) return;
 
-        // Check if we are already at the target yaw (within a small tolerance)
-        // FMath::FindDeltaAngleDegrees handles wrap-around from -180 to 180
-        float DeltaYaw = FMath::FindDeltaAngleDegrees(CurrentActualGimbalRelativeYaw, ClampedDesiredYaw);
+    const float NewDesiredYaw = GetRelativeYawTo(WorldTargetLocation);
 
-        if (FMath::Abs(DeltaYaw) > KINDA_SMALL_NUMBER) // If not already at target
+    // For the client controlling this gun, update desired yaw directly for responsiveness
+    APlayerController* PC = OwningPawn.IsValid() ? Cast<APlayerController>(OwningPawn->GetController()) : nullptr;
+    const bool bWasLocallyAimed = bLocallyAimed;
+    bLocallyAimed = PC && PC->IsLocalController();
+    if (bLocallyAimed)
+    {
+        if (FMath::Abs(FMath::FindDeltaAngleDegrees(DesiredGimbalRelativeYaw, NewDesiredYaw)) > 0.1f) // Only update if changed significantly
         {
-            float MaxRotationThisFrame = MaxYawRotationSpeed * DeltaTime;
-            float RotationAmount = FMath::Clamp(DeltaYaw, -MaxRotationThisFrame, MaxRotationThisFrame);
-            CurrentActualGimbalRelativeYaw = FRotator::NormalizeAxis(CurrentActualGimbalRelativeYaw + RotationAmount);
+            DesiredGimbalRelativeYaw = NewDesiredYaw; // Store the raw desired yaw
+            SendAimToServer(); // Coalesced to AimRpcRate
+            WakeGimbal();
         }
-        // CurrentActualGimbalRelativeYaw will be replicated to other clients.
-        // The owning client uses ClientVisualGimbalRelativeYaw for its own mesh.
     }
+    else if (MyOwner->HasAuthority()) // AI or server-controlled aiming
+    {
+         if (FMath::Abs(FMath::FindDeltaAngleDegrees(DesiredGimbalRelativeYaw, NewDesiredYaw)) > 0.1f)
+         {
+            DesiredGimbalRelativeYaw = NewDesiredYaw; // Server directly sets its desired (will be clamped later)
+            WakeGimbal();
+         }
+    }
+    if (bWasLocallyAimed != bLocallyAimed)
+    {
+        WakeGimbal(); // Visual target source changed
+    }
+    // Non-owning clients don't set DesiredGimbalRelativeYaw directly; they get both yaws through ReplicatedYaw.
+}
 
-    // --- Client Visual Rotation (Owner and Others) ---
-    // All clients (owner and remote) update their GunMeshComponent's visual rotation.
-    // The owning client interpolates towards its *locally set* DesiredGimbalRelativeYaw for responsiveness.
-    // Remote clients interpolate towards the *replicated* CurrentActualGimbalRelativeYaw.
-
-    float TargetVisualYaw = CurrentActualGimbalRelativeYaw; // Default for remote clients
+void USolaraqGimbalGunComponent::SendAimToServer()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
 
-    APlayerController* PC = Cast<APlayerController>(OwningPawn->GetController());
-    if (PC && PC->IsLocalController()) // If this is the locally controlled player's gun
+    FTimerManager& TimerManager = World->GetTimerManager();
+    if (TimerManager.IsTimerActive(AimRpcTimerHandle))
     {
-        // Owning client aims towards its own desired yaw (which it sent to server) for responsiveness
-        TargetVisualYaw = GetClampedRelativeYaw(DesiredGimbalRelativeYaw);
+        return; // Already scheduled; it sends whatever DesiredGimbalRelativeYaw is by then
     }
-    
-    // Interpolate ClientVisualGimbalRelativeYaw
-    float DeltaVisualYaw = FMath::FindDeltaAngleDegrees(ClientVisualGimbalRelativeYaw, TargetVisualYaw);
-    if (FMath::Abs(DeltaVisualYaw) > KINDA_SMALL_NUMBER)
+
+    const double NextSendTime = LastAimRpcTime + 1.0 / AimRpcRate;
+    const double Now = World->GetTimeSeconds();
+    if (Now >= NextSendTime)
     {
-        float MaxRotationThisFrame = MaxYawRotationSpeed * DeltaTime * 2.0f; // Allow client visuals to be a bit faster for snappiness
-        float RotationAmount = FMath::Clamp(DeltaVisualYaw, -MaxRotationThisFrame, MaxRotationThisFrame);
-        ClientVisualGimbalRelativeYaw = FRotator::NormalizeAxis(ClientVisualGimbalRelativeYaw + RotationAmount);
+        FlushAimToServer();
     }
     else
     {
-        ClientVisualGimbalRelativeYaw = TargetVisualYaw; // Snap if very close
+        TimerManager.SetTimer(AimRpcTimerHandle, this, &USolaraqGimbalGunComponent::FlushAimToServer, static_cast<float>(NextSendTime - Now), false);
     }
+}
 
-
-    if (GunMeshComponent)
+void USolaraqGimbalGunComponent::FlushAimToServer()
+{
+    const uint16 QuantizedYaw = FRotator::CompressAxisToShort(DesiredGimbalRelativeYaw);
+    if (QuantizedYaw != LastSentAimYaw || LastAimRpcTime < 0.0)
     {
-        GunMeshComponent->SetRelativeRotation(FRotator(0.f, ClientVisualGimbalRelativeYaw, 0.f));
+        Server_SetDesiredYaw(QuantizedYaw);
+        LastSentAimYaw = QuantizedYaw;
+        LastAckedAimYaw = INDEX_NONE; // Whether this or an earlier unreliable send lands last is unknown
+        LastAimRpcTime = GetWorld()->GetTimeSeconds();
+
+        // Unreliable: if this was the last update before the aim stops, it may never arrive. Restarted on every send.
+        GetWorld()->GetTimerManager().SetTimer(AimSettleTimerHandle, this, &USolaraqGimbalGunComponent::SendSettledAim, FMath::Max(AimSettleDelay, 0.01f), false);
     }
+}
 
-#if WITH_EDITOR
-    // Draw constraint arc in editor when selected
-    if (bEnableYawConstraints && IsSelectedInEditor())
+void USolaraqGimbalGunComponent::SendSettledAim()
+{
+    if (LastSentAimYaw != LastAckedAimYaw)
     {
-        DrawConstraintArc();
+        Server_SetSettledYaw(LastSentAimYaw);
+        LastAckedAimYaw = LastSentAimYaw;
     }
-#endif
 }
 
-void USolaraqGimbalGunComponent::AimAtWorldLocation(const FVector& WorldTargetLocation)
+void USolaraqGimbalGunComponent::Server_SetDesiredYaw_Implementation(uint16 NewDesiredYaw)
 {
-    AActor* MyOwner = GetOwner();
-    if (!MyOwner) return;
+    // Server receives the desired yaw from the client.
+    // The gimbal subsystem clamps it with constraints before updating CurrentActualGimbalRelativeYaw.
+    DesiredGimbalRelativeYaw = FRotator::NormalizeAxis(FRotator::DecompressAxisFromShort(NewDesiredYaw));
+    WakeGimbal();
+}
 
-    FVector DirectionToTargetWorld = (WorldTargetLocation - GetComponentLocation()).GetSafeNormal();
-    if (DirectionToTargetWorld.IsNearlyZero()) return;
+void USolaraqGimbalGunComponent::Server_SetSettledYaw_Implementation(uint16 NewDesiredYaw)
+{
+    Server_SetDesiredYaw_Implementation(NewDesiredYaw);
+}
 
-    // Transform world direction to local space of the parent component (or actor if no parent component)
-    FVector ParentForward = GetAttachParent() ? GetAttachParent()->GetForwardVector() : MyOwner->GetActorForwardVector();
-    FQuat ParentRotation = GetAttachParent() ? GetAttachParent()->GetComponentQuat() : MyOwner->GetActorQuat();
-    
-    FVector DirectionToTargetLocalToParent = ParentRotation.UnrotateVector(DirectionToTargetWorld);
-    DirectionToTargetLocalToParent.Z = 0; // Flatten to XY plane relative to parent
-    DirectionToTargetLocalToParent.Normalize();
+bool USolaraqGimbalGunComponent::UpdateReplicatedYaw()
+{
+    const float ClampedDesiredYaw = GetClampedRelativeYaw(DesiredGimbalRelativeYaw);
+    const uint16 QuantizedDesired = FRotator::CompressAxisToShort(ClampedDesiredYaw);
+    const uint16 QuantizedActual = FRotator::CompressAxisToShort(CurrentActualGimbalRelativeYaw);
+    if (QuantizedDesired == ReplicatedYaw.DesiredYaw && QuantizedActual == ReplicatedYaw.ActualYaw)
+    {
+        return false;
+    }
 
-    // Calculate yaw angle relative to parent's forward
-    float NewDesiredYaw = FMath::RadiansToDegrees(FMath::Atan2(DirectionToTargetLocalToParent.Y, DirectionToTargetLocalToParent.X));
-    NewDesiredYaw = FRotator::NormalizeAxis(NewDesiredYaw);
+    // Clients rotate towards DesiredYaw at MaxYawRotationSpeed just like we do, so only resend when the target moved,
+    // the gimbal arrived (exact final value) or their extrapolation would be off by more than the threshold.
+    const double Now = GetWorld()->GetTimeSeconds();
+    const bool bTargetChanged = QuantizedDesired != ReplicatedYaw.DesiredYaw;
+    const bool bArrived = QuantizedActual == QuantizedDesired;
+    bool bDrifted = false;
+    if (!bTargetChanged && !bArrived)
+    {
+        const float SentActual = FRotator::DecompressAxisFromShort(ReplicatedYaw.ActualYaw);
+        const float SentDelta = FMath::FindDeltaAngleDegrees(SentActual, FRotator::DecompressAxisFromShort(ReplicatedYaw.DesiredYaw));
+        const float MaxTravel = MaxYawRotationSpeed * static_cast<float>(Now - LastYawRepTime);
+        const float PredictedYaw = SentActual + FMath::Clamp(SentDelta, -MaxTravel, MaxTravel);
+        bDrifted = FMath::Abs(FMath::FindDeltaAngleDegrees(PredictedYaw, CurrentActualGimbalRelativeYaw)) > YawReplicationThreshold;
+    }
 
-    // For the client controlling this gun, update desired yaw directly for responsiveness
-    APlayerController* PC = OwningPawn.IsValid() ? Cast<APlayerController>(OwningPawn->GetController()) : nullptr;
-    if (PC && PC->IsLocalController())
+    if (!bTargetChanged && !bArrived && !bDrifted)
     {
-        if (FMath::Abs(FMath::FindDeltaAngleDegrees(DesiredGimbalRelativeYaw, NewDesiredYaw)) > 0.1f) // Only update if changed significantly
-        {
-            DesiredGimbalRelativeYaw = NewDesiredYaw; // Store the raw desired yaw
-            Server_SetDesiredYaw(NewDesiredYaw); // Send to server
-        }
+        return false;
     }
-    else if (MyOwner->HasAuthority()) // AI or server-controlled aiming
+
+    // A tracking turret changes target every frame; coalesce so it doesn't dirty the property every frame
+    if (MaxYawRepRate > 0.0f && Now - LastYawRepTime < 1.0 / MaxYawRepRate)
     {
-         if (FMath::Abs(FMath::FindDeltaAngleDegrees(DesiredGimbalRelativeYaw, NewDesiredYaw)) > 0.1f)
-         {
-            DesiredGimbalRelativeYaw = NewDesiredYaw; // Server directly sets its desired (will be clamped later)
-         }
+        return true;
     }
-    // Non-owning clients don't set DesiredGimbalRelativeYaw directly; they use the replicated CurrentActualGimbalRelativeYaw.
-}
 
-void USolaraqGimbalGunComponent::Server_SetDesiredYaw_Implementation(float NewDesiredYaw)
-{
-    // Server receives the desired yaw from the client.
-    // It will clamp this yaw with constraints in its TickComponent before updating CurrentActualGimbalRelativeYaw.
-    DesiredGimbalRelativeYaw = FRotator::NormalizeAxis(NewDesiredYaw);
+    ReplicatedYaw.ActualYaw = QuantizedActual;
+    ReplicatedYaw.DesiredYaw = QuantizedDesired;
+    LastYawRepTime = Now;
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(USolaraqGimbalGunComponent, ReplicatedYaw, this);
+    return false;
 }
 
-void USolaraqGimbalGunComponent::OnRep_CurrentActualGimbalRelativeYaw()
+void USolaraqGimbalGunComponent::OnRep_GimbalYaw()
 {
-    // Called on clients when CurrentActualGimbalRelativeYaw is replicated from the server.
-    // The TickComponent will use this new value to smoothly update ClientVisualGimbalRelativeYaw
-    // for remote clients. The owning client primarily drives its visuals from its own DesiredGimbalRelativeYaw
-    // but this OnRep can serve as a correction mechanism if there's drift.
-    // For simplicity, we let TickComponent handle the interpolation.
-    // UE_LOG(LogSolaraqAI, Verbose, TEXT("Client %s: OnRep_CurrentActualGimbalRelativeYaw: %.2f"), *GetNameSafe(GetOwner()), CurrentActualGimbalRelativeYaw);
+    // Called on non-owning clients. Snap the simulated yaw to the server's and let the gimbal subsystem extrapolate
+    // towards the desired yaw (and the visuals chase it) until the next update.
+    CurrentActualGimbalRelativeYaw = FRotator::DecompressAxisFromShort(ReplicatedYaw.ActualYaw);
+    DesiredGimbalRelativeYaw = FRotator::DecompressAxisFromShort(ReplicatedYaw.DesiredYaw);
+    WakeGimbal();
 }
 
 float USolaraqGimbalGunComponent::GetClampedRelativeYaw(float InYaw) const
@@ -282,6 +425,7 @@ void USolaraqGimbalGunComponent::PostEditChangeProperty(FPropertyChangedEvent& P
         ConstraintCenterRelativeYaw = FRotator::NormalizeAxis(ConstraintCenterRelativeYaw);
     }
 }
+#endif // WITH_EDITOR
 
 void USolaraqGimbalGunComponent::RequestFire()
 {
@@ -296,15 +440,30 @@ void USolaraqGimbalGunComponent::RequestFire()
 
 void USolaraqGimbalGunComponent::Server_PerformFire_Implementation()
 {
-    if (CanFire())
+    FireAuthoritative();
+}
+
+bool USolaraqGimbalGunComponent::FireAuthoritative()
+{
+    if (!GetOwner() || !GetOwner()->HasAuthority() || !CanFire())
     {
-        FireShot();
-        LastFireTime = GetWorld()->GetTimeSeconds(); // Update last fire time on server
+        return false;
     }
+
+    if (BeamWeapon)
+    {
+        BeamWeapon->SustainFire();
+        return true;
+    }
+
+    FireShot();
+    LastFireTime = GetWorld()->GetTimeSeconds(); // Update last fire time on server
+    return true;
 }
 
 bool USolaraqGimbalGunComponent::CanFire() const
 {
+    if (BeamWeapon) return true; // Continuous, no cooldown
     if (!ProjectileClass) return false;
     if (FireRate <= 0.f) return true; // Infinite fire rate if 0 or less
 
@@ -355,10 +514,36 @@ void USolaraqGimbalGunComponent::FireShot()
 
 
     FActorSpawnParameters SpawnParams;
-    SpawnParams.Owner = OwningPawn.Get(); // Projectile is owned by the Pawn
+    SpawnParams.Owner = OwningPawn.IsValid() ? OwningPawn.Get() : MyOwner; // Projectile is owned by the Pawn (or the station for turrets)
     SpawnParams.Instigator = OwningPawn.Get(); // Pawn is the instigator
     SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
+    // Guided missiles come from the pool, same as ASolaraqShipBase::PerformFireWeapon. Spawned directly they would never launch
+    if (ProjectileClass->IsChildOf(ASolaraqHomingMissile::StaticClass()))
+    {
+        FVector OwnerVelocity = FVector::ZeroVector;
+        if (const UPrimitiveComponent* RootPrim = OwningPawn.IsValid() ? Cast<UPrimitiveComponent>(OwningPawn->GetRootComponent()) : nullptr)
+        {
+            OwnerVelocity = RootPrim->GetComponentVelocity();
+        }
+
+        USolaraqMissileSubsystem* Missiles = USolaraqMissileSubsystem::Get(this);
+        const TSubclassOf<ASolaraqHomingMissile> MissileClass(ProjectileClass.Get());
+        const ASolaraqShipBase* Ship = Cast<ASolaraqShipBase>(OwningPawn.Get());
+        const FVector Velocity = OwnerVelocity + MuzzleTransform.GetRotation().GetForwardVector() * ProjectileMuzzleSpeed;
+        ASolaraqHomingMissile* Missile = Missiles ? Missiles->LaunchMissile(MissileClass, FTransform(MuzzleTransform.GetRotation(), MuzzleTransform.GetLocation()), Velocity,
+            Ship ? Ship->FindMissileTarget() : nullptr, SpawnParams.Owner, SpawnParams.Instigator) : nullptr;
+        if (Missile)
+        {
+            Missile->SetBaseDamage(BaseDamage);
+        }
+        else
+        {
+            UE_LOG(LogSolaraqCombat, Error, TEXT("Gimbal %s: Failed to launch missile!"), *GetName());
+        }
+        return;
+    }
+
     ASolaraqProjectile* SpawnedProjectile = World->SpawnActor<ASolaraqProjectile>(ProjectileClass, MuzzleTransform.GetLocation(), MuzzleTransform.GetRotation().Rotator(), SpawnParams);
 
     if (SpawnedProjectile)
@@ -394,6 +579,7 @@ void USolaraqGimbalGunComponent::FireShot()
     }
 }
 
+#if WITH_EDITOR
 void USolaraqGimbalGunComponent::DrawConstraintArc() const
 {
     if (!bEnableYawConstraints || !GetOwner() || !GetWorld()) return;
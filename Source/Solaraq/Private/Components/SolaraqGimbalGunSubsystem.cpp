@@ -0,0 +1,193 @@
+// SolaraqGimbalGunSubsystem.cpp
+
+#include "Components/SolaraqGimbalGunSubsystem.h"
+#include "Components/SolaraqGimbalGunComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+
+USolaraqGimbalGunSubsystem* USolaraqGimbalGunSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqGimbalGunSubsystem>() : nullptr;
+}
+
+bool USolaraqGimbalGunSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqGimbalGunSubsystem::Deinitialize()
+{
+    for (USolaraqGimbalGunComponent* Gun : Guns)
+    {
+        Gun->GimbalSlot = INDEX_NONE;
+    }
+    Guns.Empty();
+    States.Empty();
+    NumAwake = 0;
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqGimbalGunSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqGimbalGunSubsystem, STATGROUP_Tickables);
+}
+
+// --- Registration ---
+
+void USolaraqGimbalGunSubsystem::RegisterGun(USolaraqGimbalGunComponent* Gun)
+{
+    if (!Gun || Gun->GimbalSlot != INDEX_NONE)
+    {
+        return;
+    }
+
+    Gun->GimbalSlot = Guns.Add(Gun);
+    FGimbalState& State = States.AddDefaulted_GetRef();
+    State.ActualYaw = Gun->CurrentActualGimbalRelativeYaw;
+    State.VisualYaw = Gun->ClientVisualGimbalRelativeYaw;
+    WakeGun(Gun);
+}
+
+void USolaraqGimbalGunSubsystem::UnregisterGun(USolaraqGimbalGunComponent* Gun)
+{
+    if (!Gun || !Guns.IsValidIndex(Gun->GimbalSlot) || Guns[Gun->GimbalSlot] != Gun)
+    {
+        return;
+    }
+
+    Sleep(Gun->GimbalSlot);
+    SwapSlots(Gun->GimbalSlot, Guns.Num() - 1);
+    Guns.Pop(EAllowShrinking::No);
+    States.Pop(EAllowShrinking::No);
+    Gun->GimbalSlot = INDEX_NONE;
+}
+
+void USolaraqGimbalGunSubsystem::WakeGun(USolaraqGimbalGunComponent* Gun)
+{
+    if (!Gun || !Guns.IsValidIndex(Gun->GimbalSlot))
+    {
+        return;
+    }
+
+    const int32 Index = Gun->GimbalSlot;
+    const AActor* Owner = Gun->GetOwner();
+
+    FGimbalState& State = States[Index];
+    State.bAuthority = Owner && Owner->HasAuthority();
+    if (!State.bAuthority)
+    {
+        State.ActualYaw = Gun->CurrentActualGimbalRelativeYaw; // Last replicated value, extrapolated from here
+    }
+    State.ActualTargetYaw = Gun->GetClampedRelativeYaw(Gun->DesiredGimbalRelativeYaw);
+    State.MaxSpeed = Gun->MaxYawRotationSpeed;
+    State.bVisualFollowsActual = !Gun->bLocallyAimed;
+
+    Wake(Index);
+}
+
+// --- Awake set (partition of the arrays) ---
+
+void USolaraqGimbalGunSubsystem::SwapSlots(int32 A, int32 B)
+{
+    if (A == B)
+    {
+        return;
+    }
+    Guns.Swap(A, B);
+    States.Swap(A, B);
+    Guns[A]->GimbalSlot = A;
+    Guns[B]->GimbalSlot = B;
+}
+
+void USolaraqGimbalGunSubsystem::Wake(int32 Index)
+{
+    if (Index >= NumAwake)
+    {
+        SwapSlots(Index, NumAwake);
+        ++NumAwake;
+    }
+}
+
+void USolaraqGimbalGunSubsystem::Sleep(int32 Index)
+{
+    if (Index < NumAwake)
+    {
+        SwapSlots(Index, NumAwake - 1);
+        --NumAwake;
+    }
+}
+
+// --- Update ---
+
+void USolaraqGimbalGunSubsystem::Tick(float DeltaTime)
+{
+#if WITH_EDITOR
+    DrawEditorPreviews();
+#endif
+
+    // Backwards, so a gun going to sleep swaps with one that was already updated
+    for (int32 Index = NumAwake - 1; Index >= 0; --Index)
+    {
+        FGimbalState& State = States[Index];
+        USolaraqGimbalGunComponent* Gun = Guns[Index];
+        bool bSettled = true;
+
+        // Actual yaw approaches the clamped desired yaw at MaxYawRotationSpeed. Authoritative on the server,
+        // extrapolated from the last replicated yaw on clients.
+        const float DeltaYaw = FMath::FindDeltaAngleDegrees(State.ActualYaw, State.ActualTargetYaw);
+        if (FMath::Abs(DeltaYaw) > KINDA_SMALL_NUMBER)
+        {
+            const float MaxStep = State.MaxSpeed * DeltaTime;
+            State.ActualYaw = FRotator::NormalizeAxis(State.ActualYaw + FMath::Clamp(DeltaYaw, -MaxStep, MaxStep));
+            Gun->CurrentActualGimbalRelativeYaw = State.ActualYaw;
+            bSettled = false;
+        }
+        if (State.bAuthority && Gun->UpdateReplicatedYaw())
+        {
+            bSettled = false; // Stay awake until the held-back update goes out, or clients miss the final yaw
+        }
+
+        // Everyone: visuals chase the actual yaw (or the local aim, for the aiming player) a bit faster
+        const float VisualTarget = State.bVisualFollowsActual ? State.ActualYaw : State.ActualTargetYaw;
+        const float DeltaVisualYaw = FMath::FindDeltaAngleDegrees(State.VisualYaw, VisualTarget);
+        if (FMath::Abs(DeltaVisualYaw) > KINDA_SMALL_NUMBER)
+        {
+            const float MaxStep = State.MaxSpeed * DeltaTime * 2.0f;
+            State.VisualYaw = FMath::Abs(DeltaVisualYaw) <= MaxStep
+                ? VisualTarget
+                : FRotator::NormalizeAxis(State.VisualYaw + FMath::Sign(DeltaVisualYaw) * MaxStep);
+
+            Gun->ClientVisualGimbalRelativeYaw = State.VisualYaw;
+            if (Gun->GunMeshComponent)
+            {
+                Gun->GunMeshComponent->SetRelativeRotation(FRotator(0.f, State.VisualYaw, 0.f));
+            }
+            bSettled = false;
+        }
+
+        if (bSettled)
+        {
+            Sleep(Index);
+        }
+    }
+}
+
+#if WITH_EDITOR
+void USolaraqGimbalGunSubsystem::DrawEditorPreviews() const
+{
+    if (!GIsEditor)
+    {
+        return; // -game runs of an editor build: nothing can be selected
+    }
+
+    for (const USolaraqGimbalGunComponent* Gun : Guns)
+    {
+        if (Gun->bEnableYawConstraints && Gun->IsSelectedInEditor())
+        {
+            Gun->DrawConstraintArc();
+        }
+    }
+}
+#endif // WITH_EDITOR
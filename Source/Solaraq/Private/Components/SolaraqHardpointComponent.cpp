@@ -0,0 +1,173 @@
+// SolaraqHardpointComponent.cpp
+
+#include "Components/SolaraqHardpointComponent.h"
+#include "Pawns/SolaraqShipBase.h"
+#include "Projectiles/SolaraqHomingMissile.h"
+#include "Projectiles/SolaraqMissileSubsystem.h"
+#include "Projectiles/SolaraqProjectile.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqHardpointComponent::USolaraqHardpointComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+}
+
+// --- Heat ---
+
+float USolaraqHardpointComponent::GetHeat() const
+{
+    const UWorld* World = GetWorld();
+    const double Now = World ? World->GetTimeSeconds() : HeatStampTime;
+    return FMath::Max(0.0f, HeatAtStamp - HeatDissipationPerSecond * static_cast<float>(Now - HeatStampTime));
+}
+
+bool USolaraqHardpointComponent::IsOverheated() const
+{
+    return bOverheated && GetHeat() > OverheatRecoveryHeat;
+}
+
+float USolaraqHardpointComponent::GetDamagePerSecond(TSubclassOf<ASolaraqProjectile> DefaultProjectileClass, int32 Group) const
+{
+    float DamagePerSalvoCycle = 0.0f;
+    float HeatPerSalvoCycle = 0.0f;
+    for (const FSolaraqHardpointSlot& Slot : Slots)
+    {
+        if (Slot.Group != Group)
+        {
+            continue;
+        }
+        const TSubclassOf<ASolaraqProjectile> Class = Slot.ProjectileClass ? Slot.ProjectileClass : DefaultProjectileClass;
+        if (const ASolaraqProjectile* ProjectileCDO = Class ? Class->GetDefaultObject<ASolaraqProjectile>() : nullptr)
+        {
+            DamagePerSalvoCycle += ProjectileCDO->BaseDamage;
+            HeatPerSalvoCycle += Slot.HeatPerShot;
+        }
+    }
+
+    const float RawDPS = DamagePerSalvoCycle / GroupFireInterval;
+    const float HeatPerSecond = HeatPerSalvoCycle / GroupFireInterval;
+    if (HeatPerSecond <= HeatDissipationPerSecond || HeatPerSecond <= 0.0f)
+    {
+        return RawDPS;
+    }
+    return RawDPS * (HeatDissipationPerSecond / HeatPerSecond);
+}
+
+// --- Firing ---
+
+FTransform USolaraqHardpointComponent::GetSlotWorldTransform(const FSolaraqHardpointSlot& Slot) const
+{
+    const USceneComponent* Parent = GetAttachParent();
+    const FTransform Base = (Slot.Socket != NAME_None && Parent && Parent->DoesSocketExist(Slot.Socket))
+        ? Parent->GetSocketTransform(Slot.Socket)
+        : GetComponentTransform();
+    return FTransform(FRotator(0.0f, Slot.Yaw, 0.0f), Slot.Offset) * Base;
+}
+
+int32 USolaraqHardpointComponent::FireGroup(int32 Group, TSubclassOf<ASolaraqProjectile> DefaultProjectileClass, float MuzzleSpeed, const FVector& InheritedVelocity)
+{
+    const AActor* MyOwner = GetOwner();
+    UWorld* World = GetWorld();
+    if (!MyOwner || !MyOwner->HasAuthority() || !World || Group < 0)
+    {
+        return 0;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    if (GroupReadyTimes.IsValidIndex(Group) && Now < GroupReadyTimes[Group])
+    {
+        return 0;
+    }
+    if (IsOverheated())
+    {
+        return 0;
+    }
+    bOverheated = false;
+
+    SalvoScratch.Reset();
+    float SalvoHeat = 0.0f;
+    for (const FSolaraqHardpointSlot& Slot : Slots)
+    {
+        if (Slot.Group != Group)
+        {
+            continue;
+        }
+        UClass* Class = Slot.ProjectileClass ? Slot.ProjectileClass.Get() : DefaultProjectileClass.Get();
+        if (!Class)
+        {
+            continue;
+        }
+        SalvoScratch.Add({ Class, GetSlotWorldTransform(Slot) });
+        SalvoHeat += Slot.HeatPerShot;
+    }
+
+    if (SalvoScratch.Num() == 0)
+    {
+        return 0;
+    }
+
+    SpawnSalvo(SalvoScratch, MuzzleSpeed, InheritedVelocity);
+
+    if (!GroupReadyTimes.IsValidIndex(Group))
+    {
+        GroupReadyTimes.SetNumZeroed(Group + 1);
+    }
+    GroupReadyTimes[Group] = Now + GroupFireInterval;
+
+    HeatAtStamp = GetHeat() + SalvoHeat;
+    HeatStampTime = Now;
+    if (HeatAtStamp >= MaxHeat)
+    {
+        HeatAtStamp = MaxHeat;
+        bOverheated = true;
+        UE_LOG(LogSolaraqCombat, Verbose, TEXT("%s: Hardpoints overheated"), *GetNameSafe(MyOwner));
+    }
+
+    return SalvoScratch.Num();
+}
+
+void USolaraqHardpointComponent::SpawnSalvo(TConstArrayView<FSalvoShot> Shots, float MuzzleSpeed, const FVector& InheritedVelocity)
+{
+    UWorld* World = GetWorld();
+    AActor* MyOwner = GetOwner();
+
+    // Shared by every shot of the salvo
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Owner = MyOwner;
+    SpawnParams.Instigator = Cast<APawn>(MyOwner);
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    for (const FSalvoShot& Shot : Shots)
+    {
+        // Guided missiles come from the pool, same as ASolaraqShipBase::PerformFireWeapon. Spawned directly they would never launch
+        if (Shot.ProjectileClass->IsChildOf(ASolaraqHomingMissile::StaticClass()))
+        {
+            USolaraqMissileSubsystem* Missiles = USolaraqMissileSubsystem::Get(this);
+            const TSubclassOf<ASolaraqHomingMissile> MissileClass(Shot.ProjectileClass.Get());
+            const ASolaraqShipBase* Ship = Cast<ASolaraqShipBase>(MyOwner);
+            const FVector Velocity = InheritedVelocity + Shot.Transform.GetRotation().GetForwardVector() * MuzzleSpeed;
+            if (!Missiles || !Missiles->LaunchMissile(MissileClass, Shot.Transform, Velocity, Ship ? Ship->FindMissileTarget() : nullptr, MyOwner, SpawnParams.Instigator))
+            {
+                UE_LOG(LogSolaraqProjectile, Error, TEXT("%s: Hardpoint failed to launch %s"), *GetNameSafe(MyOwner), *GetNameSafe(Shot.ProjectileClass));
+            }
+            continue;
+        }
+
+        ASolaraqProjectile* Projectile = World->SpawnActor<ASolaraqProjectile>(Shot.ProjectileClass, Shot.Transform, SpawnParams);
+        if (!Projectile)
+        {
+            UE_LOG(LogSolaraqProjectile, Error, TEXT("%s: Hardpoint failed to spawn %s"), *GetNameSafe(MyOwner), *GetNameSafe(Shot.ProjectileClass));
+            continue;
+        }
+
+        // Same as ASolaraqShipBase::PerformFireWeapon: set after spawning so InitialSpeed doesn't override it
+        if (UProjectileMovementComponent* ProjMoveComp = Projectile->GetProjectileMovement())
+        {
+            ProjMoveComp->Velocity = InheritedVelocity + Shot.Transform.GetRotation().GetForwardVector() * MuzzleSpeed;
+            ProjMoveComp->UpdateComponentVelocity();
+        }
+    }
+}
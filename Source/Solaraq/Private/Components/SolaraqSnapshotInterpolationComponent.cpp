@@ -0,0 +1,164 @@
+// SolaraqSnapshotInterpolationComponent.cpp
+
+#include "Components/SolaraqSnapshotInterpolationComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/ReplicatedState.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/GameStateBase.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqSnapshotInterpolationComponent::USolaraqSnapshotInterpolationComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false; // Only proxies tick, once snapshots arrive
+    PrimaryComponentTick.TickGroup = TG_PrePhysics;
+}
+
+void USolaraqSnapshotInterpolationComponent::BeginPlay()
+{
+    Super::BeginPlay();
+
+    AActor* Owner = GetOwner();
+    if (bEnabled && Owner && Owner->HasAuthority() && ServerNetUpdateFrequency > 0.0f)
+    {
+        // Clients fill the gaps, so the server can send far less often
+        Owner->SetNetUpdateFrequency(ServerNetUpdateFrequency);
+    }
+}
+
+float USolaraqSnapshotInterpolationComponent::GetServerUpdateFrequency(const AActor* Actor)
+{
+    const USolaraqSnapshotInterpolationComponent* Component = Actor->FindComponentByClass<USolaraqSnapshotInterpolationComponent>();
+    return Component && Component->bEnabled && Component->ServerNetUpdateFrequency > 0.0f
+        ? Component->ServerNetUpdateFrequency
+        : Actor->GetNetUpdateFrequency();
+}
+
+double USolaraqSnapshotInterpolationComponent::GetServerTime() const
+{
+    const UWorld* World = GetWorld();
+    const AGameStateBase* GameState = World->GetGameState();
+    return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+bool USolaraqSnapshotInterpolationComponent::ConsumeSnapshot(double ServerTime, const FRepMovement& Movement)
+{
+    if (!bEnabled || bPaused || GetOwnerRole() != ROLE_SimulatedProxy)
+    {
+        return false;
+    }
+
+    // Out of order or duplicate: the newer state is already buffered
+    if (Snapshots.Num() > 0 && ServerTime <= Snapshots.Last().ServerTime)
+    {
+        return true;
+    }
+
+    if (Snapshots.Num() >= MaxSnapshots)
+    {
+        Snapshots.RemoveAt(0, Snapshots.Num() - MaxSnapshots + 1, EAllowShrinking::No);
+    }
+
+    FSolaraqMovementSnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+    Snapshot.ServerTime = ServerTime;
+    Snapshot.Location = Movement.Location;
+    Snapshot.Rotation = Movement.Rotation.Quaternion();
+    Snapshot.LinearVelocity = Movement.LinearVelocity;
+
+    if (!bInterpolating)
+    {
+        StartInterpolating();
+    }
+    return true;
+}
+
+void USolaraqSnapshotInterpolationComponent::SetPaused(bool bInPaused)
+{
+    if (bPaused == bInPaused)
+    {
+        return;
+    }
+
+    bPaused = bInPaused;
+    Snapshots.Reset(); // Pre-pause states are stale either way, and interpolating from them would snap the actor back
+    if (bInterpolating)
+    {
+        SetComponentTickEnabled(!bPaused);
+    }
+    UE_LOG(LogSolaraqSystem, Verbose, TEXT("%s: snapshot interpolation %s."), *GetNameSafe(GetOwner()), bPaused ? TEXT("paused") : TEXT("resumed"));
+}
+
+void USolaraqSnapshotInterpolationComponent::StartInterpolating()
+{
+    bInterpolating = true;
+    if (UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(GetOwner()->GetRootComponent()))
+    {
+        Root->SetSimulatePhysics(false); // Kinematic on this client; the server simulates
+    }
+    SetComponentTickEnabled(true);
+    UE_LOG(LogSolaraqSystem, Verbose, TEXT("%s: snapshot interpolation active."), *GetNameSafe(GetOwner()));
+}
+
+void USolaraqSnapshotInterpolationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    AActor* Owner = GetOwner();
+    if (!Owner || Snapshots.Num() == 0)
+    {
+        return;
+    }
+
+    const double RenderTime = GetServerTime() - InterpolationDelay;
+
+    // Keep one snapshot at or before RenderTime as the interpolation start
+    int32 NumExpired = 0;
+    while (NumExpired + 1 < Snapshots.Num() && Snapshots[NumExpired + 1].ServerTime <= RenderTime)
+    {
+        ++NumExpired;
+    }
+    if (NumExpired > 0)
+    {
+        Snapshots.RemoveAt(0, NumExpired, EAllowShrinking::No);
+    }
+
+    const FSolaraqMovementSnapshot& From = Snapshots[0];
+    FVector Location;
+    FQuat Rotation;
+    FVector Velocity;
+
+    if (Snapshots.Num() >= 2 && RenderTime >= From.ServerTime)
+    {
+        // Hermite between the bracketing snapshots, velocities as tangents
+        const FSolaraqMovementSnapshot& To = Snapshots[1];
+        const float Span = static_cast<float>(To.ServerTime - From.ServerTime);
+        const float Alpha = FMath::Clamp(static_cast<float>(RenderTime - From.ServerTime) / Span, 0.0f, 1.0f);
+        const FVector FromTangent = From.LinearVelocity * Span;
+        const FVector ToTangent = To.LinearVelocity * Span;
+        Location = FMath::CubicInterp(From.Location, FromTangent, To.Location, ToTangent, Alpha);
+        Velocity = FMath::CubicInterpDerivative(From.Location, FromTangent, To.Location, ToTangent, Alpha) / Span;
+        Rotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha);
+    }
+    else if (RenderTime >= From.ServerTime)
+    {
+        // Starved (late or lost packets): carry on along the last velocity for a while
+        const float Ahead = FMath::Min(static_cast<float>(RenderTime - From.ServerTime), MaxExtrapolationTime);
+        Location = From.Location + From.LinearVelocity * Ahead;
+        Velocity = Ahead < MaxExtrapolationTime ? From.LinearVelocity : FVector::ZeroVector;
+        Rotation = From.Rotation;
+    }
+    else
+    {
+        // Still filling the delay window
+        Location = From.Location;
+        Velocity = From.LinearVelocity;
+        Rotation = From.Rotation;
+    }
+
+    Owner->SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+    if (USceneComponent* Root = Owner->GetRootComponent())
+    {
+        Root->ComponentVelocity = Velocity; // GetVelocity() for aim prediction on this client
+    }
+}
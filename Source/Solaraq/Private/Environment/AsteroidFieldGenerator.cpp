@@ -7,6 +7,8 @@
 #include "Math/RandomStream.h"       // For seeded random numbers
 #include "Logging/SolaraqLogChannels.h" // Your custom logging, good!
 #include "UObject/ConstructorHelpers.h" // For MakeUniqueObjectName
+#include "AI/SolaraqObstacleFieldSubsystem.h" // So AI ships can steer around our asteroids
+#include "Engine/StaticMesh.h"
 
 // Constructor: This is where we set up default values and create our components.
 AAsteroidFieldGenerator::AAsteroidFieldGenerator()
@@ -79,6 +81,66 @@ void AAsteroidFieldGenerator::BeginPlay()
     {
         // GenerateAsteroids(); // Optionally generate at runtime
     }
+
+    // The AI only runs on the server, so only the server needs to know where the rocks are.
+    if (HasAuthority())
+    {
+        RegisterObstacles();
+    }
+}
+
+void AAsteroidFieldGenerator::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UnregisterObstacles();
+    Super::EndPlay(EndPlayReason);
+}
+
+void AAsteroidFieldGenerator::RegisterObstacles()
+{
+    USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this);
+    if (!ObstacleField)
+    {
+        return;
+    }
+
+    UnregisterObstacles(); // In case we get called twice
+
+    for (const TObjectPtr<UHierarchicalInstancedStaticMeshComponent>& HISM : HISMComponents)
+    {
+        if (!HISM || !HISM->GetStaticMesh())
+        {
+            continue;
+        }
+
+        // Each asteroid becomes a circle: mesh bounding sphere scaled by the instance's biggest axis.
+        const float MeshRadius = HISM->GetStaticMesh()->GetBounds().SphereRadius;
+        const int32 InstanceCount = HISM->GetInstanceCount();
+        ObstacleHandles.Reserve(ObstacleHandles.Num() + InstanceCount);
+
+        for (int32 InstanceIndex = 0; InstanceIndex < InstanceCount; ++InstanceIndex)
+        {
+            FTransform InstanceTransform;
+            if (HISM->GetInstanceTransform(InstanceIndex, InstanceTransform, true)) // true = world space
+            {
+                const float Radius = MeshRadius * InstanceTransform.GetMaximumAxisScale();
+                ObstacleHandles.Add(ObstacleField->AddObstacle(InstanceTransform.GetLocation(), Radius));
+            }
+        }
+    }
+
+    UE_LOG(LogSolaraqSystem, Log, TEXT("AsteroidFieldGenerator %s: Registered %d asteroids with the AI obstacle field."), *GetName(), ObstacleHandles.Num());
+}
+
+void AAsteroidFieldGenerator::UnregisterObstacles()
+{
+    if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+    {
+        for (int32& Handle : ObstacleHandles)
+        {
+            ObstacleField->RemoveObstacle(Handle);
+        }
+    }
+    ObstacleHandles.Reset();
 }
 
 // This is called when the Actor is placed in the editor or when its properties are changed
@@ -9,6 +9,7 @@
 #include "Components/PrimitiveComponent.h" // For AddForce
 #include "Components/BoxComponent.h" // For accessing ship's physics root
 #include "Logging/SolaraqLogChannels.h" // Optional: Use your custom logging
+#include "AI/SolaraqObstacleFieldSubsystem.h"
 
 
 ACelestialBodyBase::ACelestialBodyBase()
@@ -119,6 +120,16 @@ void ACelestialBodyBase::BeginPlay()
     UpdateInfluenceSphereRadius();
     UpdateScalingSphereRadius();
 
+    // Let AI ships steer around the body mesh (not the influence sphere, that one is meant to be flown through)
+    if (HasAuthority() && BodyMeshComponent)
+    {
+        if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+        {
+            ObstacleHandle = ObstacleField->AddObstacle(BodyMeshComponent->Bounds.Origin, BodyMeshComponent->Bounds.SphereRadius);
+            BodyMeshComponent->TransformUpdated.AddUObject(this, &ACelestialBodyBase::OnBodyMeshTransformUpdated);
+        }
+    }
+
     // --- Validation checks in BeginPlay remain important ---
     if (MaxInfluenceDistance <= 0) // Check if radius is valid
     {
@@ -148,6 +159,28 @@ void ACelestialBodyBase::BeginPlay()
     // ------------------------------------------------------
 }
 
+void ACelestialBodyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+    {
+        ObstacleField->RemoveObstacle(ObstacleHandle);
+    }
+    if (BodyMeshComponent)
+    {
+        BodyMeshComponent->TransformUpdated.RemoveAll(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ACelestialBodyBase::OnBodyMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+    {
+        ObstacleField->UpdateObstacle(ObstacleHandle, UpdatedComponent->Bounds.Origin, UpdatedComponent->Bounds.SphereRadius);
+    }
+}
+
 void ACelestialBodyBase::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
@@ -0,0 +1,144 @@
+// SolaraqDamageSubsystem.cpp
+
+#include "Gameplay/Combat/SolaraqDamageSubsystem.h"
+#include "Engine/DamageEvents.h"
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/DamageType.h"
+#include "Gameplay/Destructibles/SolaraqDestructibleObjectBase.h"
+#include "Logging/SolaraqLogChannels.h"
+#include "Pawns/SolaraqShipBase.h"
+
+USolaraqDamageSubsystem* USolaraqDamageSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqDamageSubsystem>() : nullptr;
+}
+
+bool USolaraqDamageSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqDamageSubsystem::Deinitialize()
+{
+    Pending.Empty();
+    PendingIndex.Empty();
+    Flushing.Empty();
+    OnDamageApplied.Clear();
+    OnTargetKilled.Clear();
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqDamageSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqDamageSubsystem, STATGROUP_Tickables);
+}
+
+// --- Queueing ---
+
+void USolaraqDamageSubsystem::QueuePointDamage(AActor* Target, float Damage, const FHitResult& Hit, const FVector& ShotDirection,
+    TSubclassOf<UDamageType> DamageTypeClass, AController* Instigator, AActor* DamageCauser)
+{
+    if (!Target || Damage <= 0.0f || !Target->HasAuthority())
+    {
+        return;
+    }
+
+    if (!DamageTypeClass)
+    {
+        DamageTypeClass = UDamageType::StaticClass();
+    }
+
+    if (USolaraqDamageSubsystem* DamageSubsystem = Get(Target))
+    {
+        DamageSubsystem->AddDamage(Target, Damage, Hit, ShotDirection, DamageTypeClass, Instigator, DamageCauser);
+        return;
+    }
+
+    // No subsystem (e.g. editor preview worlds): apply right away
+    const FPointDamageEvent DamageEvent(Damage, Hit, ShotDirection, DamageTypeClass);
+    Target->TakeDamage(Damage, DamageEvent, Instigator, DamageCauser);
+}
+
+void USolaraqDamageSubsystem::AddDamage(AActor* Target, float Damage, const FHitResult& Hit, const FVector& ShotDirection,
+    TSubclassOf<UDamageType> DamageTypeClass, AController* Instigator, AActor* DamageCauser)
+{
+    const TWeakObjectPtr<AActor> Key(Target);
+    int32& Index = PendingIndex.FindOrAdd(Key, INDEX_NONE);
+    if (Index == INDEX_NONE)
+    {
+        Index = Pending.AddDefaulted();
+        Pending[Index].Target = Key;
+    }
+
+    FSolaraqPendingDamage& Entry = Pending[Index];
+    Entry.TotalDamage += Damage;
+    ++Entry.NumHits;
+    Entry.LastHit = Hit;
+    Entry.LastShotDirection = ShotDirection;
+    Entry.DamageTypeClass = DamageTypeClass;
+    Entry.Instigator = Instigator;
+    Entry.DamageCauser = DamageCauser;
+}
+
+// --- Flush ---
+
+void USolaraqDamageSubsystem::Tick(float DeltaTime)
+{
+    FlushPendingDamage();
+}
+
+void USolaraqDamageSubsystem::FlushPendingDamage()
+{
+    if (Pending.Num() == 0 || Flushing.Num() > 0)
+    {
+        return; // Nothing queued, or called re-entrantly from a TakeDamage handler
+    }
+
+    // Swap out first: TakeDamage handlers (destruction, chain reactions) may queue more damage for next frame
+    Flushing.Reset();
+    Swap(Flushing, Pending);
+    PendingIndex.Reset();
+
+    for (const FSolaraqPendingDamage& Entry : Flushing)
+    {
+        AActor* Target = Entry.Target.Get();
+        if (!Target || IsTargetDead(*Target))
+        {
+            continue;
+        }
+
+        AController* Instigator = Entry.Instigator.Get();
+        AActor* DamageCauser = Entry.DamageCauser.Get();
+        const FPointDamageEvent DamageEvent(Entry.TotalDamage, Entry.LastHit, Entry.LastShotDirection, Entry.DamageTypeClass);
+        const float AppliedDamage = Target->TakeDamage(Entry.TotalDamage, DamageEvent, Instigator, DamageCauser);
+
+        if (AppliedDamage > 0.0f)
+        {
+            UE_LOG(LogSolaraqCombat, Verbose, TEXT("%s took %.1f damage from %d hit(s) this frame"), *Target->GetName(), AppliedDamage, Entry.NumHits);
+            OnDamageApplied.Broadcast(Target, AppliedDamage, Entry.NumHits);
+        }
+
+        if (IsTargetDead(*Target))
+        {
+            OnTargetKilled.Broadcast(Target, Instigator, DamageCauser);
+        }
+    }
+
+    Flushing.Reset();
+}
+
+bool USolaraqDamageSubsystem::IsTargetDead(const AActor& Target)
+{
+    if (const ASolaraqShipBase* Ship = Cast<ASolaraqShipBase>(&Target))
+    {
+        return Ship->IsDead();
+    }
+    if (const ASolaraqDestructibleObjectBase* Destructible = Cast<ASolaraqDestructibleObjectBase>(&Target))
+    {
+        return Destructible->IsDestroyed();
+    }
+    return !IsValid(&Target);
+}
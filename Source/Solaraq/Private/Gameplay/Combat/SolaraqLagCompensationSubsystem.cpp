@@ -0,0 +1,224 @@
+// SolaraqLagCompensationSubsystem.cpp
+
+#include "Gameplay/Combat/SolaraqLagCompensationSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Pawns/SolaraqShipBase.h"
+
+USolaraqLagCompensationSubsystem* USolaraqLagCompensationSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqLagCompensationSubsystem>() : nullptr;
+}
+
+bool USolaraqLagCompensationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqLagCompensationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    HistoryLength = FMath::Clamp(MaxHistorySamples, 2, 256);
+    SampleTimes.SetNumZeroed(HistoryLength);
+}
+
+void USolaraqLagCompensationSubsystem::Deinitialize()
+{
+    SampleTimes.Empty();
+    Ships.Empty();
+    Radii.Empty();
+    Locations.Empty();
+    Yaws.Empty();
+    FreeSlots.Empty();
+    Head = INDEX_NONE;
+    NumSamples = 0;
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqLagCompensationSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqLagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+// --- Registration ---
+
+int32 USolaraqLagCompensationSubsystem::RegisterShip(ASolaraqShipBase* Ship)
+{
+    if (!Ship)
+    {
+        return INDEX_NONE;
+    }
+
+    int32 Slot;
+    if (FreeSlots.Num() > 0)
+    {
+        Slot = FreeSlots.Pop(EAllowShrinking::No);
+        Ships[Slot] = Ship;
+    }
+    else
+    {
+        Slot = Ships.Add(Ship);
+        Radii.AddZeroed();
+        Locations.AddUninitialized(HistoryLength);
+        Yaws.AddUninitialized(HistoryLength);
+    }
+
+    // No history yet: pretend it has always been here
+    Radii[Slot] = Ship->GetSimpleCollisionRadius();
+    const FVector Location = Ship->GetActorLocation();
+    const float Yaw = Ship->GetActorRotation().Yaw;
+    for (int32 Sample = 0; Sample < HistoryLength; ++Sample)
+    {
+        Locations[Slot * HistoryLength + Sample] = Location;
+        Yaws[Slot * HistoryLength + Sample] = Yaw;
+    }
+    return Slot;
+}
+
+void USolaraqLagCompensationSubsystem::UnregisterShip(int32& Handle)
+{
+    if (Ships.IsValidIndex(Handle) && Ships[Handle].IsValid())
+    {
+        Ships[Handle] = nullptr;
+        FreeSlots.Add(Handle);
+    }
+    Handle = INDEX_NONE;
+}
+
+// --- Recording ---
+
+void USolaraqLagCompensationSubsystem::Tick(float DeltaTime)
+{
+    const UWorld* World = GetWorld();
+    if (HistoryLength == 0 || World->GetNetMode() == NM_Client)
+    {
+        return;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    if (Head != INDEX_NONE && Now - SampleTimes[Head] < MinSampleInterval)
+    {
+        return;
+    }
+
+    Head = (Head + 1) % HistoryLength;
+    NumSamples = FMath::Min(NumSamples + 1, HistoryLength);
+    SampleTimes[Head] = Now;
+
+    for (int32 Slot = 0; Slot < Ships.Num(); ++Slot)
+    {
+        if (const ASolaraqShipBase* Ship = Ships[Slot].Get())
+        {
+            Locations[Slot * HistoryLength + Head] = Ship->GetActorLocation();
+            Yaws[Slot * HistoryLength + Head] = Ship->GetActorRotation().Yaw;
+        }
+    }
+}
+
+// --- Queries ---
+
+double USolaraqLagCompensationSubsystem::GetViewTime(const AController* Shooter) const
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    const APlayerController* PlayerController = Cast<APlayerController>(Shooter);
+    if (!PlayerController || PlayerController->IsLocalController() || !PlayerController->PlayerState)
+    {
+        return Now;
+    }
+
+    // Ping is a round trip; the client's input left half a ping ago, showing a world already ViewInterpolationDelay old
+    const double Latency = PlayerController->PlayerState->GetPingInMilliseconds() * 0.0005 + ViewInterpolationDelay;
+    return Now - FMath::Clamp(Latency, 0.0, static_cast<double>(MaxRewindTime));
+}
+
+bool USolaraqLagCompensationSubsystem::FindSampleBracket(double Time, int32& OutOlder, int32& OutNewer, float& OutAlpha) const
+{
+    if (NumSamples == 0)
+    {
+        return false;
+    }
+
+    OutNewer = Head;
+    OutOlder = Head;
+    OutAlpha = 0.0f;
+    if (Time >= SampleTimes[Head])
+    {
+        return true;
+    }
+
+    for (int32 Step = 1; Step < NumSamples; ++Step)
+    {
+        const int32 Sample = (Head - Step + HistoryLength) % HistoryLength;
+        if (SampleTimes[Sample] <= Time)
+        {
+            OutOlder = Sample;
+            const double Span = SampleTimes[OutNewer] - SampleTimes[Sample];
+            OutAlpha = Span > UE_SMALL_NUMBER ? static_cast<float>((Time - SampleTimes[Sample]) / Span) : 0.0f;
+            return true;
+        }
+        OutNewer = Sample;
+    }
+
+    // Older than the window: clamp to the oldest sample
+    OutOlder = OutNewer;
+    return true;
+}
+
+bool USolaraqLagCompensationSubsystem::GetShipTransformAtTime(const ASolaraqShipBase* Ship, double Time, FTransform& OutTransform) const
+{
+    const int32 Slot = Ship ? Ship->LagCompensationHandle : INDEX_NONE;
+    int32 Older, Newer;
+    float Alpha;
+    if (!Ships.IsValidIndex(Slot) || Ships[Slot] != Ship || !FindSampleBracket(Time, Older, Newer, Alpha))
+    {
+        return false;
+    }
+
+    const float OlderYaw = Yaws[Slot * HistoryLength + Older];
+    const float Yaw = OlderYaw + FMath::FindDeltaAngleDegrees(OlderYaw, Yaws[Slot * HistoryLength + Newer]) * Alpha;
+    OutTransform = FTransform(FRotator(0.0f, Yaw, 0.0f), LerpLocation(Slot, Older, Newer, Alpha), Ship->GetActorScale3D());
+    return true;
+}
+
+ASolaraqShipBase* USolaraqLagCompensationSubsystem::SegmentTestAtTime(const FVector& Start, const FVector& End, float Radius, double Time,
+    const AActor* IgnoreActor, float& OutDistance) const
+{
+    int32 Older, Newer;
+    float Alpha;
+    if (!FindSampleBracket(Time, Older, Newer, Alpha))
+    {
+        return nullptr;
+    }
+
+    ASolaraqShipBase* BestShip = nullptr;
+    float BestDistSq = TNumericLimits<float>::Max();
+    for (int32 Slot = 0; Slot < Ships.Num(); ++Slot)
+    {
+        ASolaraqShipBase* Ship = Ships[Slot].Get();
+        if (!Ship || Ship == IgnoreActor || Ship->IsDead())
+        {
+            continue;
+        }
+
+        const FVector Location = LerpLocation(Slot, Older, Newer, Alpha);
+        const FVector Closest = FMath::ClosestPointOnSegment(Location, Start, End);
+        if (FVector::DistSquared(Closest, Location) > FMath::Square(Radii[Slot] + Radius))
+        {
+            continue;
+        }
+
+        const float DistSq = FVector::DistSquared(Start, Closest);
+        if (DistSq < BestDistSq)
+        {
+            BestDistSq = DistSq;
+            BestShip = Ship;
+        }
+    }
+
+    OutDistance = BestShip ? FMath::Sqrt(BestDistSq) : 0.0f;
+    return BestShip;
+}
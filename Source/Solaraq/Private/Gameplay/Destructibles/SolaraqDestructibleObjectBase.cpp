@@ -7,11 +7,14 @@
 #include "Sound/SoundCue.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "Network/SolaraqPushModel.h"
 #include "Engine/CollisionProfile.h"
 #include "Engine/DamageEvents.h"
 #include "Field/FieldSystemComponent.h"
 #include "Field/FieldSystemObjects.h"
 #include "Logging/SolaraqLogChannels.h"
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h"
+#include "AI/SolaraqObstacleFieldSubsystem.h"
 // #include "Field/FieldSystemObjects.h" // Include if using advanced field systems directly from C++
 
 // Logging Helper Macro (ensure you have this defined, e.g., in SolaraqLogChannels.h or a PCH)
@@ -55,8 +58,10 @@ ASolaraqDestructibleObjectBase::ASolaraqDestructibleObjectBase()
 void ASolaraqDestructibleObjectBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-    DOREPLIFETIME(ASolaraqDestructibleObjectBase, CurrentHealth_Internal);
-    DOREPLIFETIME(ASolaraqDestructibleObjectBase, bIsDestroyed_Internal);
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqDestructibleObjectBase, CurrentHealth_Internal, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqDestructibleObjectBase, bIsDestroyed_Internal, Params);
 }
 
 void ASolaraqDestructibleObjectBase::BeginPlay()
@@ -67,6 +72,24 @@ void ASolaraqDestructibleObjectBase::BeginPlay()
     {
         CurrentHealth_Internal = MaxHealth;
         bIsDestroyed_Internal = false;
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqDestructibleObjectBase, CurrentHealth_Internal, this);
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqDestructibleObjectBase, bIsDestroyed_Internal, this);
+
+        // Intact destructibles are obstacles for AI steering
+        if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+        {
+            const FBoxSphereBounds Bounds = GetRootComponent() ? GetRootComponent()->Bounds : FBoxSphereBounds(GetActorLocation(), FVector::ZeroVector, 0.0f);
+            ObstacleHandle = ObstacleField->AddObstacle(Bounds.Origin, Bounds.SphereRadius);
+            if (GetRootComponent())
+            {
+                GetRootComponent()->TransformUpdated.AddUObject(this, &ASolaraqDestructibleObjectBase::OnRootTransformUpdated);
+            }
+        }
+    }
+
+    if (USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this))
+    {
+        TeamHandle = Teams->RegisterTeamAgent(this, TeamId);
     }
 
     if (GeometryCollectionComponent)
@@ -80,19 +103,43 @@ void ASolaraqDestructibleObjectBase::BeginPlay()
     if (GimbalGunComponent)
     {
         GimbalGunComponent->SetVisibility(bCanHostGimbalGun, true);
-        GimbalGunComponent->SetComponentTickEnabled(bCanHostGimbalGun);
         if (!bCanHostGimbalGun)
         {
             GimbalGunComponent->Deactivate();
         }
-        else
-        {
-            // OwningPawn setup for the gun needs careful consideration
-            // Since this actor isn't a Pawn, the gun's current SetOwningPawn might not work directly.
-            // The gun should be modified to get TeamID from its AActor owner if it implements IGenericTeamAgentInterface.
-            // For now, the gun might not have a valid OwningPawn if attached to this.
-            // It can still get its team from this actor via GetOwner()->GetGenericTeamId() if the gun is adapted.
-        }
+        // No OwningPawn here. With bAutonomousTargeting the turret targeting subsystem resolves the team from this
+        // actor (team subsystem) and projectiles are owned by this actor.
+    }
+}
+
+void ASolaraqDestructibleObjectBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this))
+    {
+        Teams->UnregisterTeamAgent(TeamHandle);
+    }
+    if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+    {
+        ObstacleField->RemoveObstacle(ObstacleHandle);
+    }
+    if (GetRootComponent())
+    {
+        GetRootComponent()->TransformUpdated.RemoveAll(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASolaraqDestructibleObjectBase::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+    if (ObstacleHandle == INDEX_NONE)
+    {
+        return; // Already destroyed
+    }
+
+    if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+    {
+        ObstacleField->UpdateObstacle(ObstacleHandle, UpdatedComponent->Bounds.Origin, UpdatedComponent->Bounds.SphereRadius);
     }
 }
 
@@ -114,6 +161,7 @@ float ASolaraqDestructibleObjectBase::TakeDamage(float DamageAmount, FDamageEven
         {
             CurrentHealth_Internal -= ActualDamage;
             CurrentHealth_Internal = FMath::Max(0.0f, CurrentHealth_Internal);
+            SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqDestructibleObjectBase, CurrentHealth_Internal, this);
 
             if (CurrentHealth_Internal <= 0.0f)
             {
@@ -134,6 +182,13 @@ void ASolaraqDestructibleObjectBase::HandleDestruction(AActor* DamageCauser, con
 
     NET_LOG_DEST(LogSolaraqCombat, Log, TEXT("Actor %s destroyed by %s! Triggering Chaos Destruction."), *GetName(), *GetNameSafe(DamageCauser));
     bIsDestroyed_Internal = true;
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqDestructibleObjectBase, bIsDestroyed_Internal, this);
+
+    // The chunks fly apart, no point steering around the old footprint anymore
+    if (USolaraqObstacleFieldSubsystem* ObstacleField = USolaraqObstacleFieldSubsystem::Get(this))
+    {
+        ObstacleField->RemoveObstacle(ObstacleHandle);
+    }
 
     Multicast_PlayMainDestructionEffects();
 
@@ -0,0 +1,9 @@
+// SolaraqTeamSettings.cpp
+
+#include "Gameplay/Teams/SolaraqTeamSettings.h"
+
+USolaraqTeamSettings::USolaraqTeamSettings()
+{
+    CategoryName = TEXT("Game");
+    SectionName = TEXT("Solaraq Teams");
+}
@@ -0,0 +1,150 @@
+// SolaraqTeamSubsystem.cpp
+
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h"
+#include "Gameplay/Teams/SolaraqTeamSettings.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/Controller.h"
+#include "Engine/World.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqTeamSubsystem* USolaraqTeamSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqTeamSubsystem>() : nullptr;
+}
+
+void USolaraqTeamSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+    BuildAttitudeMatrix();
+}
+
+void USolaraqTeamSubsystem::Deinitialize()
+{
+    TeamIds.Reset();
+    HandleOwners.Reset();
+    FreeHandles.Reset();
+    ActorToHandle.Reset();
+    AttitudeMatrix.Reset();
+    NumFactions = 0;
+
+    Super::Deinitialize();
+}
+
+void USolaraqTeamSubsystem::BuildAttitudeMatrix()
+{
+    const USolaraqTeamSettings* Settings = GetDefault<USolaraqTeamSettings>();
+
+    // FGenericTeamId is a uint8 and 255 is NoTeam, so at most 255 real factions
+    NumFactions = FMath::Min(Settings->Factions.Num(), static_cast<int32>(FGenericTeamId::NoTeam.GetId()));
+    AttitudeMatrix.SetNumUninitialized(NumFactions * NumFactions);
+
+    for (int32 From = 0; From < NumFactions; ++From)
+    {
+        const FSolaraqFactionDefinition& Faction = Settings->Factions[From];
+        for (int32 To = 0; To < NumFactions; ++To)
+        {
+            const ETeamAttitude::Type Attitude = Faction.AttitudeTowards.IsValidIndex(To)
+                ? Faction.AttitudeTowards[To].GetValue()
+                : GetDefaultAttitude(FGenericTeamId(From), FGenericTeamId(To));
+            AttitudeMatrix[From * NumFactions + To] = static_cast<uint8>(Attitude);
+        }
+    }
+
+    UE_LOG(LogSolaraqAI, Log, TEXT("SolaraqTeamSubsystem: Built %dx%d faction attitude matrix."), NumFactions, NumFactions);
+}
+
+ETeamAttitude::Type USolaraqTeamSubsystem::GetDefaultAttitude(FGenericTeamId FromTeam, FGenericTeamId ToTeam)
+{
+    if (FromTeam == FGenericTeamId::NoTeam || ToTeam == FGenericTeamId::NoTeam)
+    {
+        return ETeamAttitude::Neutral;
+    }
+    return FromTeam == ToTeam ? ETeamAttitude::Friendly : ETeamAttitude::Hostile;
+}
+
+FSolaraqTeamHandle USolaraqTeamSubsystem::RegisterTeamAgent(const AActor* Actor, FGenericTeamId InTeamId)
+{
+    FSolaraqTeamHandle Handle;
+    if (!Actor)
+    {
+        return Handle;
+    }
+
+    // Re-registering just refreshes the cached team
+    if (const int32* ExistingIndex = ActorToHandle.Find(Actor))
+    {
+        Handle.Index = *ExistingIndex;
+        TeamIds[Handle.Index] = InTeamId;
+        return Handle;
+    }
+
+    if (FreeHandles.Num() > 0)
+    {
+        Handle.Index = FreeHandles.Pop(EAllowShrinking::No);
+        TeamIds[Handle.Index] = InTeamId;
+        HandleOwners[Handle.Index] = Actor;
+    }
+    else
+    {
+        Handle.Index = TeamIds.Add(InTeamId);
+        HandleOwners.Add(Actor);
+    }
+
+    ActorToHandle.Add(Actor, Handle.Index);
+    return Handle;
+}
+
+void USolaraqTeamSubsystem::UnregisterTeamAgent(FSolaraqTeamHandle& Handle)
+{
+    if (!TeamIds.IsValidIndex(Handle.Index))
+    {
+        Handle.Reset();
+        return;
+    }
+
+    ActorToHandle.Remove(HandleOwners[Handle.Index]);
+    HandleOwners[Handle.Index] = TObjectKey<AActor>();
+    TeamIds[Handle.Index] = FGenericTeamId::NoTeam;
+    FreeHandles.Add(Handle.Index);
+    Handle.Reset();
+}
+
+void USolaraqTeamSubsystem::SetTeamId(const FSolaraqTeamHandle& Handle, FGenericTeamId InTeamId)
+{
+    if (TeamIds.IsValidIndex(Handle.Index))
+    {
+        TeamIds[Handle.Index] = InTeamId;
+    }
+}
+
+FGenericTeamId USolaraqTeamSubsystem::FindTeamId(const AActor& Actor) const
+{
+    if (const int32* Index = ActorToHandle.Find(&Actor))
+    {
+        return TeamIds[*Index];
+    }
+    return ResolveTeamIdSlow(Actor);
+}
+
+FGenericTeamId USolaraqTeamSubsystem::ResolveTeamIdSlow(const AActor& Actor)
+{
+    if (const APawn* Pawn = Cast<const APawn>(&Actor))
+    {
+        // Controller team wins (AI controllers own the team of the ships they fly)
+        if (const IGenericTeamAgentInterface* ControllerAgent = Cast<const IGenericTeamAgentInterface>(Pawn->GetController()))
+        {
+            const FGenericTeamId ControllerTeam = ControllerAgent->GetGenericTeamId();
+            if (ControllerTeam != FGenericTeamId::NoTeam)
+            {
+                return ControllerTeam;
+            }
+        }
+    }
+
+    if (const IGenericTeamAgentInterface* Agent = Cast<const IGenericTeamAgentInterface>(&Actor))
+    {
+        return Agent->GetGenericTeamId();
+    }
+    return FGenericTeamId::NoTeam;
+}
@@ -0,0 +1,51 @@
+// SolaraqPushModel.cpp
+
+#include "Network/SolaraqPushModel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "UObject/ObjectKey.h"
+
+namespace SolaraqPushModel
+{
+    namespace
+    {
+        // Game thread only, like the server writes that feed it
+        bool bRecording = false;
+        TSet<TPair<FObjectKey, FName>> MarkedProperties;
+    }
+
+    void BeginRecording()
+    {
+        check(IsInGameThread());
+        bRecording = true;
+        MarkedProperties.Reset();
+    }
+
+    void EndRecording()
+    {
+        check(IsInGameThread());
+        bRecording = false;
+        MarkedProperties.Reset();
+    }
+
+    bool IsRecording()
+    {
+        return bRecording && IsInGameThread();
+    }
+
+    void RecordPropertyDirty(const UObject* Object, FName PropertyName)
+    {
+        if (IsRecording())
+        {
+            MarkedProperties.Add(TPair<FObjectKey, FName>(FObjectKey(Object), PropertyName));
+        }
+    }
+
+    bool WasPropertyMarkedDirty(const UObject* Object, FName PropertyName)
+    {
+        return MarkedProperties.Contains(TPair<FObjectKey, FName>(FObjectKey(Object), PropertyName));
+    }
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
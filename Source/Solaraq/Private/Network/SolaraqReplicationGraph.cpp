@@ -0,0 +1,292 @@
+// SolaraqReplicationGraph.cpp
+
+#include "Network/SolaraqReplicationGraph.h"
+#include "Components/SolaraqSnapshotInterpolationComponent.h"
+#include "Engine/NetDriver.h"
+#include "Environment/AsteroidFieldGenerator.h"
+#include "Environment/CelestialBodyBase.h"
+#include "Environment/SolaraqSatellite.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Info.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Gameplay/Destructibles/SolaraqDestructibleObjectBase.h"
+#include "Gameplay/Pickups/SolaraqPickupBase.h"
+#include "Logging/SolaraqLogChannels.h"
+#include "Pawns/SolaraqShipBase.h"
+#include "Projectiles/SolaraqProjectile.h"
+
+// --- Owned Actors Node ---
+
+void USolaraqReplicationGraphNode_OwnedActors::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+    ReplicationActorList.Reset();
+
+    for (const FNetViewer& Viewer : Params.Viewers)
+    {
+        ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+        ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+        if (const APlayerController* PlayerController = Cast<APlayerController>(Viewer.InViewer))
+        {
+            ReplicationActorList.ConditionalAdd(PlayerController->GetPawn());
+            ReplicationActorList.ConditionalAdd(PlayerController->PlayerState);
+        }
+    }
+
+    // Own pawn at full rate for this connection only; a pawn we no longer control goes back to its global period
+    TArray<AActor*, TInlineAllocator<2>> ViewerPawns;
+    for (const FNetViewer& Viewer : Params.Viewers)
+    {
+        const APlayerController* PlayerController = Cast<APlayerController>(Viewer.InViewer);
+        APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+        if (Pawn && Pawn->GetIsReplicated())
+        {
+            ViewerPawns.Add(Pawn);
+        }
+    }
+
+    for (int32 Index = FullRatePawns.Num() - 1; Index >= 0; --Index)
+    {
+        AActor* Pawn = FullRatePawns[Index].Get();
+        if (Pawn && ViewerPawns.Contains(Pawn))
+        {
+            continue;
+        }
+        if (Pawn)
+        {
+            const FGlobalActorReplicationInfo* GlobalInfo = GraphGlobals.IsValid() ? GraphGlobals->GlobalActorReplicationInfoMap->Find(Pawn) : nullptr;
+            FConnectionReplicationActorInfo* ConnectionInfo = Params.ConnectionManager.ActorInfoMap.Find(Pawn);
+            if (GlobalInfo && ConnectionInfo)
+            {
+                ConnectionInfo->ReplicationPeriodFrame = GlobalInfo->Settings.ReplicationPeriodFrame;
+            }
+        }
+        FullRatePawns.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+    }
+
+    for (AActor* Pawn : ViewerPawns)
+    {
+        Params.ConnectionManager.ActorInfoMap.FindOrAdd(Pawn).ReplicationPeriodFrame = OwnPawnPeriodFrame;
+        FullRatePawns.AddUnique(Pawn);
+    }
+
+    for (AActor* Actor : OwnedActors)
+    {
+        ReplicationActorList.ConditionalAdd(Actor);
+    }
+
+    Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+}
+
+// --- Graph Setup ---
+
+void USolaraqReplicationGraph::ResetGameWorldState()
+{
+    Super::ResetGameWorldState();
+
+    PendingOwnedActors.Reset();
+}
+
+uint32 USolaraqReplicationGraph::GetPeriodFrames(float UpdateFrequency) const
+{
+    const float TickRate = NetDriver ? static_cast<float>(NetDriver->GetNetServerMaxTickRate()) : 30.0f;
+    return UpdateFrequency > 0.0f ? static_cast<uint32>(FMath::Max(FMath::RoundToInt32(TickRate / UpdateFrequency), 1)) : 1u;
+}
+
+void USolaraqReplicationGraph::InitGlobalActorClassSettings()
+{
+    Super::InitGlobalActorClassSettings();
+
+    // Grid actors: replicate at the class' own rate, culled at the class' own distance
+    auto SetSpatialClassInfo = [this](UClass* Class)
+    {
+        const AActor* ActorCDO = Class->GetDefaultObject<AActor>();
+        FClassReplicationInfo ClassInfo;
+        ClassInfo.SetCullDistanceSquared(ActorCDO->GetNetCullDistanceSquared());
+        ClassInfo.ReplicationPeriodFrame = GetPeriodFrames(USolaraqSnapshotInterpolationComponent::GetServerUpdateFrequency(ActorCDO));
+        GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+    };
+    SetSpatialClassInfo(ASolaraqShipBase::StaticClass());
+    SetSpatialClassInfo(ASolaraqProjectile::StaticClass());
+    SetSpatialClassInfo(ASolaraqPickupBase::StaticClass());
+    SetSpatialClassInfo(ASolaraqSatellite::StaticClass());
+    SetSpatialClassInfo(ASolaraqDestructibleObjectBase::StaticClass());
+
+    // Static scenery: relevant everywhere, but nothing changes after the initial bunch
+    FClassReplicationInfo StaticInfo;
+    StaticInfo.ReplicationPeriodFrame = GetPeriodFrames(1.0f / FMath::Max(StaticActorUpdateInterval, UE_KINDA_SMALL_NUMBER));
+    GlobalActorReplicationInfoMap.SetClassInfo(ACelestialBodyBase::StaticClass(), StaticInfo);
+    GlobalActorReplicationInfoMap.SetClassInfo(AAsteroidFieldGenerator::StaticClass(), StaticInfo);
+
+    // Destruction infos for grid actors reach as far as ships can see
+    const float ShipCullDistanceSquared = ASolaraqShipBase::StaticClass()->GetDefaultObject<AActor>()->GetNetCullDistanceSquared();
+    DestructInfoMaxDistanceSquared = FMath::Max(DestructInfoMaxDistanceSquared, ShipCullDistanceSquared);
+}
+
+void USolaraqReplicationGraph::InitGlobalGraphNodes()
+{
+    GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+    GridNode->CellSize = GridCellSize;
+    GridNode->SpatialBias = FVector2D(SpatialBiasX, SpatialBiasY);
+    AddGlobalGraphNode(GridNode);
+
+    AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+    AddGlobalGraphNode(AlwaysRelevantNode);
+
+    UE_LOG(LogSolaraqSystem, Log, TEXT("SolaraqReplicationGraph: grid cell %.0f, bias (%.0f, %.0f)."), GridCellSize, SpatialBiasX, SpatialBiasY);
+}
+
+void USolaraqReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+    Super::InitConnectionGraphNodes(RepGraphConnection);
+
+    USolaraqReplicationGraphNode_OwnedActors* OwnedNode = CreateNewNode<USolaraqReplicationGraphNode_OwnedActors>();
+    OwnedNode->SetOwnPawnPeriodFrame(GetPeriodFrames(ASolaraqShipBase::StaticClass()->GetDefaultObject<AActor>()->GetNetUpdateFrequency()));
+    AddConnectionGraphNode(OwnedNode, RepGraphConnection);
+    OwnedActorNodes.Add(RepGraphConnection, OwnedNode);
+
+    // Owner-only actors that arrived before this connection did
+    for (int32 Index = PendingOwnedActors.Num() - 1; Index >= 0; --Index)
+    {
+        AActor* Actor = PendingOwnedActors[Index].Get();
+        if (!Actor || RouteOwnedActor(Actor))
+        {
+            PendingOwnedActors.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+        }
+    }
+}
+
+void USolaraqReplicationGraph::OnRemoveConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+    OwnedActorNodes.Remove(RepGraphConnection);
+
+    Super::OnRemoveConnectionGraphNodes(RepGraphConnection);
+}
+
+// --- Routing ---
+
+ESolaraqRepNodeMapping USolaraqReplicationGraph::GetMappingPolicy(const UClass* Class)
+{
+    if (const ESolaraqRepNodeMapping* Cached = MappingCache.Find(Class))
+    {
+        return *Cached;
+    }
+
+    const AActor* ActorCDO = Class->GetDefaultObject<AActor>();
+    ESolaraqRepNodeMapping Mapping;
+    if (Class->IsChildOf(APlayerController::StaticClass()))
+    {
+        Mapping = ESolaraqRepNodeMapping::NotRouted; // Gathered per connection from its viewers
+    }
+    else if (Class->IsChildOf(ACelestialBodyBase::StaticClass()) || Class->IsChildOf(AAsteroidFieldGenerator::StaticClass())
+        || Class->IsChildOf(AInfo::StaticClass()) || ActorCDO->bAlwaysRelevant)
+    {
+        Mapping = ESolaraqRepNodeMapping::AlwaysRelevant; // Includes game state and player states
+    }
+    else if (ActorCDO->bOnlyRelevantToOwner)
+    {
+        Mapping = ESolaraqRepNodeMapping::RelevantOwnerOnly;
+    }
+    else if (Class->IsChildOf(ASolaraqDestructibleObjectBase::StaticClass()))
+    {
+        Mapping = ESolaraqRepNodeMapping::Spatialize_Dormancy;
+    }
+    else if (!ActorCDO->GetRootComponent() || ActorCDO->IsRootComponentStatic())
+    {
+        Mapping = ESolaraqRepNodeMapping::Spatialize_Static;
+    }
+    else
+    {
+        // Ships, projectiles, pickups, satellites and anything else that moves
+        Mapping = ESolaraqRepNodeMapping::Spatialize_Dynamic;
+    }
+
+    MappingCache.Add(Class, Mapping);
+    return Mapping;
+}
+
+bool USolaraqReplicationGraph::RouteOwnedActor(AActor* Actor)
+{
+    UNetConnection* Connection = Actor->GetNetConnection();
+    UNetReplicationGraphConnection* RepGraphConnection = Connection ? FindOrAddConnectionManager(Connection) : nullptr;
+    const TObjectPtr<USolaraqReplicationGraphNode_OwnedActors>* OwnedNode = RepGraphConnection ? OwnedActorNodes.Find(RepGraphConnection) : nullptr;
+    if (!OwnedNode)
+    {
+        return false;
+    }
+
+    (*OwnedNode)->AddOwnedActor(Actor);
+    return true;
+}
+
+void USolaraqReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+    // Per actor, so a blueprint's own interpolation settings win over the native class defaults
+    if (ActorInfo.Actor->FindComponentByClass<USolaraqSnapshotInterpolationComponent>())
+    {
+        GlobalInfo.Settings.ReplicationPeriodFrame = GetPeriodFrames(USolaraqSnapshotInterpolationComponent::GetServerUpdateFrequency(ActorInfo.Actor));
+    }
+
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+    case ESolaraqRepNodeMapping::AlwaysRelevant:
+        AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+        break;
+
+    case ESolaraqRepNodeMapping::RelevantOwnerOnly:
+        if (!RouteOwnedActor(ActorInfo.Actor))
+        {
+            PendingOwnedActors.Add(ActorInfo.Actor);
+        }
+        break;
+
+    case ESolaraqRepNodeMapping::Spatialize_Static:
+        GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+        break;
+
+    case ESolaraqRepNodeMapping::Spatialize_Dynamic:
+        GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+        break;
+
+    case ESolaraqRepNodeMapping::Spatialize_Dormancy:
+        GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void USolaraqReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+    switch (GetMappingPolicy(ActorInfo.Class))
+    {
+    case ESolaraqRepNodeMapping::AlwaysRelevant:
+        AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+        break;
+
+    case ESolaraqRepNodeMapping::RelevantOwnerOnly:
+        PendingOwnedActors.RemoveSingleSwap(ActorInfo.Actor);
+        for (const TPair<TObjectPtr<UNetReplicationGraphConnection>, TObjectPtr<USolaraqReplicationGraphNode_OwnedActors>>& Pair : OwnedActorNodes)
+        {
+            Pair.Value->RemoveOwnedActor(ActorInfo.Actor);
+        }
+        break;
+
+    case ESolaraqRepNodeMapping::Spatialize_Static:
+        GridNode->RemoveActor_Static(ActorInfo);
+        break;
+
+    case ESolaraqRepNodeMapping::Spatialize_Dynamic:
+        GridNode->RemoveActor_Dynamic(ActorInfo);
+        break;
+
+    case ESolaraqRepNodeMapping::Spatialize_Dormancy:
+        GridNode->RemoveActor_Dormancy(ActorInfo);
+        break;
+
+    default:
+        break;
+    }
+}
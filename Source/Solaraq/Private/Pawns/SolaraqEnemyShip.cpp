@@ -4,6 +4,10 @@
 #include "Logging/SolaraqLogChannels.h" // Your custom log channel
 #include "Components/BoxComponent.h" // For physics root access
 #include "Components/SphereComponent.h"
+#include "AI/SolaraqShipAvoidanceSubsystem.h"
+#include "AI/SolaraqAIProfile.h"
+#include "AI/SolaraqShipSteeringSubsystem.h"
+#include "Network/SolaraqPushModel.h"
 
 ASolaraqEnemyShip::ASolaraqEnemyShip()
 {
@@ -16,6 +20,71 @@ void ASolaraqEnemyShip::BeginPlay()
 {
     Super::BeginPlay();
     LastFireTime = -FireRate; // Allow firing immediately
+
+    // --- Register for ship-to-ship avoidance (AI steering is server-side) ---
+    if (HasAuthority() && bEnableShipAvoidance && CollisionAndPhysicsRoot)
+    {
+        if (USolaraqShipAvoidanceSubsystem* Avoidance = USolaraqShipAvoidanceSubsystem::Get(this))
+        {
+            const float Radius = AvoidanceRadius > 0.0f ? AvoidanceRadius : CollisionAndPhysicsRoot->GetScaledSphereRadius();
+            AvoidanceHandle = Avoidance->RegisterAgent(CollisionAndPhysicsRoot, Radius);
+        }
+    }
+
+    // --- Physics-thread steering (falls back to game-thread torque if unavailable) ---
+    if (HasAuthority() && bUsePhysicsThreadSteering && CollisionAndPhysicsRoot && CollisionAndPhysicsRoot->IsSimulatingPhysics())
+    {
+        if (USolaraqShipSteeringSubsystem* Steering = USolaraqShipSteeringSubsystem::Get(this))
+        {
+            SteeringHandle = Steering->RegisterBody(CollisionAndPhysicsRoot);
+        }
+    }
+}
+
+void ASolaraqEnemyShip::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (AvoidanceHandle != INDEX_NONE)
+    {
+        if (USolaraqShipAvoidanceSubsystem* Avoidance = USolaraqShipAvoidanceSubsystem::Get(this))
+        {
+            Avoidance->UnregisterAgent(AvoidanceHandle);
+        }
+    }
+    UnregisterSteering();
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASolaraqEnemyShip::UnregisterSteering()
+{
+    if (SteeringHandle != INDEX_NONE)
+    {
+        if (USolaraqShipSteeringSubsystem* Steering = USolaraqShipSteeringSubsystem::Get(this))
+        {
+            Steering->UnregisterBody(SteeringHandle);
+        }
+        SteeringHandle = INDEX_NONE;
+    }
+}
+
+FVector ASolaraqEnemyShip::GetAvoidanceVelocity(const FVector& DesiredVelocity) const
+{
+    if (AvoidanceHandle == INDEX_NONE)
+    {
+        return DesiredVelocity;
+    }
+    const USolaraqShipAvoidanceSubsystem* Avoidance = USolaraqShipAvoidanceSubsystem::Get(this);
+    if (!Avoidance)
+    {
+        return DesiredVelocity;
+    }
+
+    FSolaraqAvoidanceParams Params;
+    Params.TimeHorizon = AvoidanceTimeHorizon;
+    Params.NeighborRadius = AvoidanceNeighborRadius;
+    Params.MaxNeighbors = AvoidanceMaxNeighbors;
+    Params.MaxSpeed = IsBoosting() ? BoostMaxSpeed : NormalMaxSpeed;
+    return Avoidance->ComputeAvoidanceVelocity(AvoidanceHandle, DesiredVelocity, Params);
 }
 
 void ASolaraqEnemyShip::Tick(float DeltaTime)
@@ -75,6 +144,7 @@ void ASolaraqEnemyShip::HandleDestruction()
 
     // 1. Set the dead state (this will replicate via OnRep_IsDead)
     bIsDead = true;
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsDead, this);
 
     // 2. Immediately trigger visual/audio effects on all clients via Multicast
     Multicast_PlayDestructionEffects();
@@ -88,6 +158,16 @@ void ASolaraqEnemyShip::HandleDestruction()
         CollisionAndPhysicsRoot->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
     }
     SetActorTickEnabled(false); // Stop ticking
+
+    // Wreck no longer steers, stop other ships reacting to it
+    if (AvoidanceHandle != INDEX_NONE)
+    {
+        if (USolaraqShipAvoidanceSubsystem* Avoidance = USolaraqShipAvoidanceSubsystem::Get(this))
+        {
+            Avoidance->UnregisterAgent(AvoidanceHandle);
+        }
+    }
+    UnregisterSteering();
     SetActorEnableCollision(ECollisionEnabled::NoCollision);
      if (CollisionAndPhysicsRoot) CollisionAndPhysicsRoot->SetCollisionEnabled(ECollisionEnabled::NoCollision);
      if (ShipMeshComponent) ShipMeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -110,9 +190,20 @@ void ASolaraqEnemyShip::TurnTowards(const FVector& TargetLocation)
     if (!CollisionAndPhysicsRoot || IsDead() || !CollisionAndPhysicsRoot->IsSimulatingPhysics()) return;
 
     const FVector CurrentLocation = GetActorLocation();
-    const FVector DirectionToTarget = (TargetLocation - CurrentLocation).GetSafeNormal();
+    FVector DirectionToTarget = (TargetLocation - CurrentLocation).GetSafeNormal();
     if (DirectionToTarget.IsNearlyZero()) return;
 
+    // --- Local avoidance: while thrusting, heading == thrust direction, so bend it around nearby ships ---
+    if (LastRequestedThrust > KINDA_SMALL_NUMBER)
+    {
+        const float MaxSpeed = IsBoosting() ? BoostMaxSpeed : NormalMaxSpeed;
+        const FVector SafeVelocity = GetAvoidanceVelocity(DirectionToTarget * MaxSpeed * LastRequestedThrust);
+        if (!SafeVelocity.IsNearlyZero())
+        {
+            DirectionToTarget = SafeVelocity.GetSafeNormal();
+        }
+    }
+
     FRotator TargetRotation = DirectionToTarget.Rotation();
     FRotator CurrentRotation = CollisionAndPhysicsRoot->GetComponentRotation(); // Use physics rotation
 
@@ -122,16 +213,32 @@ void ASolaraqEnemyShip::TurnTowards(const FVector& TargetLocation)
     float TargetYaw = TargetRotation.Yaw;
     float YawDifference = FMath::FindDeltaAngleDegrees(CurrentYaw, TargetYaw);
 
+    const FSolaraqTurnTuning& Turning = (AIProfile ? *AIProfile : USolaraqAIProfile::GetDefaultProfile()).Turning;
+
+    // --- Physics-thread PD steering: submit the heading, the callback does the rest every substep ---
+    if (SteeringHandle != INDEX_NONE)
+    {
+        if (USolaraqShipSteeringSubsystem* Steering = USolaraqShipSteeringSubsystem::Get(this))
+        {
+            // Same peak acceleration as the legacy path; stiffness reaches it at SlowdownAngle
+            FSolaraqYawGains Gains;
+            Gains.MaxAcceleration = Turning.MaxTurnTorque;
+            Gains.Stiffness = Turning.MaxTurnTorque / Turning.SlowdownAngle;
+            Gains.Damping = 2.0f * Turning.YawDampingRatio * FMath::Sqrt(Gains.Stiffness);
+            Steering->SetDesiredYaw(SteeringHandle, TargetYaw, Gains);
+            return;
+        }
+    }
+
     // --- Stop applying torque when very close to the target angle ---
-    // Tune this threshold (degrees) - Start maybe a bit higher like 2.0 or 3.0
-    if (FMath::Abs(YawDifference) < 2.0f)
+    if (FMath::Abs(YawDifference) < Turning.AlignedAngle)
     {
         // Optionally reduce/zero out angular velocity when very close to target angle
         FVector CurrentAngularVel = CollisionAndPhysicsRoot->GetPhysicsAngularVelocityInDegrees();
         if(FMath::Abs(CurrentAngularVel.Z) > 1.0f) // Only dampen if spinning significantly
         {
             // Apply damping faster when close to target
-            CollisionAndPhysicsRoot->SetPhysicsAngularVelocityInDegrees(FVector(CurrentAngularVel.X, CurrentAngularVel.Y, CurrentAngularVel.Z * 0.5f));
+            CollisionAndPhysicsRoot->SetPhysicsAngularVelocityInDegrees(FVector(CurrentAngularVel.X, CurrentAngularVel.Y, CurrentAngularVel.Z * Turning.AlignedSpinDamping));
             //UE_LOG(LogSolaraqAI, Warning, TEXT("%s TurnTowards: Yaw difference small (%.2f). Applying damping to AngVelZ: %.2f"), *GetName(), YawDifference, CurrentAngularVel.Z * 0.5f);
         }
         else {
@@ -140,21 +247,13 @@ void ASolaraqEnemyShip::TurnTowards(const FVector& TargetLocation)
         return; // Don't apply positive torque if already aligned
     }
 
-    // --- Torque Calculation ---
-    // Start with the MaxTurnTorque value that was previously causing overshoot
-    float MaxTurnTorque = 3000.0f; // <<< YOUR PREVIOUSLY TUNED VALUE (The one that was too fast)
+    // --- Torque Calculation (constants come from the AI profile) ---
     float TurnDirection = FMath::Sign(YawDifference);
 
     // --- Proportional Torque Calculation ---
-    // Angle (degrees) at which to start reducing torque. Tune this value!
-    // Start larger (e.g., 90) and decrease if it still overshoots.
-    float SlowdownAngle = 90.0f; // <<< TUNABLE (Try 180, 90, 60, 45, 30...)
-    // Minimum factor prevents zero torque when far from target. Tune if needed (0.05 - 0.2 range usually ok)
-    float MinTorqueFactor = 0.5f; // <<< TUNABLE
-
     // Calculate scaling factor: 1.0 when angle diff >= SlowdownAngle, decreasing linearly to MinTorqueFactor.
-    float TorqueFactor = FMath::Clamp(FMath::Abs(YawDifference) / SlowdownAngle, MinTorqueFactor, 1.0f);
-    float TorqueMagnitude = MaxTurnTorque * TorqueFactor;
+    float TorqueFactor = FMath::Clamp(FMath::Abs(YawDifference) / Turning.SlowdownAngle, Turning.MinTorqueFactor, 1.0f);
+    float TorqueMagnitude = Turning.MaxTurnTorque * TorqueFactor;
     // --- End Proportional Torque ---
 
     FVector TorqueToApply = FVector(0.f, 0.f, TurnDirection * TorqueMagnitude);
@@ -184,6 +283,27 @@ void ASolaraqEnemyShip::RequestMoveForward(float Value)
      }
       if(IsDead()) return;
 
+     // --- Local avoidance: ease off the throttle if full thrust on this heading runs into another ship ---
+     LastRequestedThrust = Value;
+     if (Value > KINDA_SMALL_NUMBER && AvoidanceHandle != INDEX_NONE)
+     {
+          const float MaxSpeed = IsBoosting() ? BoostMaxSpeed : NormalMaxSpeed;
+          const FVector Forward = GetActorForwardVector();
+          const FVector SafeVelocity = GetAvoidanceVelocity(Forward * MaxSpeed * Value);
+          Value = FMath::Clamp(FVector::DotProduct(SafeVelocity, Forward) / FMath::Max(MaxSpeed, 1.0f), 0.0f, Value);
+     }
+
+     // Physics-thread steering holds the thrust every step until the AI changes it
+     if (SteeringHandle != INDEX_NONE)
+     {
+          if (USolaraqShipSteeringSubsystem* Steering = USolaraqShipSteeringSubsystem::Get(this))
+          {
+               const float ActualThrust = bIsBoosting ? (ThrustForce * BoostThrustMultiplier) : ThrustForce;
+               Steering->SetThrust(SteeringHandle, Value * ActualThrust);
+               return;
+          }
+     }
+
      // Directly call the movement processing logic (or the Server RPC if that contains more logic)
      // Since ProcessMoveForwardInput is protected in base, we can call it if needed,
      // OR just call the Server RPC which is public. Calling the RPC is safer if we
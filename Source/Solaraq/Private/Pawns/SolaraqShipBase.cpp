@@ -15,8 +15,20 @@
 #include "GameFramework/PlayerController.h" // Needed for IsLocalController() potentially later
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Gameplay/Pickups/SolaraqPickupBase.h"
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h"
+#include "AI/SolaraqThreatMapSubsystem.h"
+#include "Gameplay/Combat/SolaraqLagCompensationSubsystem.h"
 #include "Net/UnrealNetwork.h"
+#include "Network/SolaraqPushModel.h"
 #include "Projectiles/SolaraqProjectile.h"
+#include "Components/SolaraqHardpointComponent.h"
+#include "Components/SolaraqBeamWeaponComponent.h"
+#include "Components/SolaraqSnapshotInterpolationComponent.h"
+#include "Projectiles/SolaraqSalvoSubsystem.h"
+#include "Projectiles/SolaraqHomingMissile.h"
+#include "Projectiles/SolaraqMissileSubsystem.h"
+#include "AI/SolaraqAIController.h"
+#include "EngineUtils.h"
 
 // Simple Logging Helper Macro
 #define NET_LOG(LogCat, Verbosity, Format, ...) \
@@ -110,6 +122,13 @@ ASolaraqShipBase::ASolaraqShipBase()
         MuzzlePoint->SetRelativeLocation(FVector(100.0f, 0.0f, 0.0f));
     }
 
+    // --- Create Hardpoints (empty by default; slots are set up in Blueprint) ---
+    Hardpoints = CreateDefaultSubobject<USolaraqHardpointComponent>(TEXT("Hardpoints"));
+    Hardpoints->SetupAttachment(ShipMeshComponent ? static_cast<USceneComponent*>(ShipMeshComponent) : CollisionAndPhysicsRoot);
+
+    // --- Remote ship smoothing (active on other clients only) ---
+    SnapshotInterpolation = CreateDefaultSubobject<USolaraqSnapshotInterpolationComponent>(TEXT("SnapshotInterpolation"));
+
     // Default Weapon Values
     ProjectileMuzzleSpeed = 8000.0f;
     FireRate = 0.5f;
@@ -172,6 +191,8 @@ void ASolaraqShipBase::Server_DockWithPad(UDockingPadComponent* PadToDockWith)
 
     bIsDocked = true;
     DockedToPadComponent = PadToDockWith;
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsDocked, this);
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, DockedToPadComponent, this);
 
     // Perform the physics changes and attachment
     PerformDockingAttachment();
@@ -202,6 +223,12 @@ void ASolaraqShipBase::OnRep_IsDocked()
         // Note: Attachment is handled by engine's movement replication, physics disabling isn't replicated directly
         // but the lack of simulation + attachment achieves the same result visually.
 
+        // The attachment places the ship now; interpolating old snapshots would teleport it off the pad every tick
+        if (SnapshotInterpolation)
+        {
+            SnapshotInterpolation->SetPaused(true);
+        }
+
         // Crucially, make sure the client *stops* simulating physics if it was doing any client-side prediction
         if(CollisionAndPhysicsRoot && CollisionAndPhysicsRoot->IsSimulatingPhysics())
         {
@@ -219,7 +246,14 @@ void ASolaraqShipBase::OnRep_IsDocked()
         // Ensure physics simulation is re-enabled visually (though server dictates actual position)
         // Note: Detachment is handled by engine replication. Client may need to re-enable physics
         // simulation locally IF it uses it for prediction/smoothing, but be careful not to fight the server.
-        if(CollisionAndPhysicsRoot && !CollisionAndPhysicsRoot->IsSimulatingPhysics())
+        if (SnapshotInterpolation)
+        {
+            SnapshotInterpolation->SetPaused(false);
+        }
+
+        // Interpolated proxies stay kinematic, the snapshots drive them
+        const bool bInterpolated = SnapshotInterpolation && SnapshotInterpolation->IsInterpolating();
+        if(CollisionAndPhysicsRoot && !bInterpolated && !CollisionAndPhysicsRoot->IsSimulatingPhysics())
         {
             CollisionAndPhysicsRoot->SetSimulatePhysics(true); // Re-enable local simulation if needed for effects/prediction
             UE_LOG(LogSolaraqSystem, Verbose, TEXT("CLIENT Ship %s: Re-enabling local physics simulation due to undocking."), *GetName());
@@ -254,6 +288,7 @@ float ASolaraqShipBase::TakeDamage(float DamageAmount, struct FDamageEvent const
     if (HasAuthority())
     {
         CurrentHealth = FMath::Clamp(CurrentHealth - ActualDamage, 0.0f, MaxHealth);
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentHealth, this);
         NET_LOG(LogSolaraqCombat, Log, TEXT("Took %.1f damage from %s. CurrentHealth: %.1f"), ActualDamage, *GetNameSafe(DamageCauser), CurrentHealth);
 
         // Check if the ship is destroyed
@@ -268,6 +303,58 @@ float ASolaraqShipBase::TakeDamage(float DamageAmount, struct FDamageEvent const
     return ActualDamage; // Return the damage that was actually applied
 }
 
+float ASolaraqShipBase::GetWeaponDamagePerSecond() const
+{
+    if (MainBeamWeapon)
+    {
+        return MainBeamWeapon->DamagePerSecond;
+    }
+    if (Hardpoints && Hardpoints->HasSlots())
+    {
+        return Hardpoints->GetDamagePerSecond(ProjectileClass, USolaraqHardpointComponent::PrimaryGroup); // The only group PerformFireWeapon fires
+    }
+    if (SalvoPattern && FireRate > 0.0f)
+    {
+        return SalvoPattern->PelletCount * SalvoPattern->DamagePerPellet / FireRate;
+    }
+
+    const ASolaraqProjectile* ProjectileCDO = ProjectileClass ? ProjectileClass->GetDefaultObject<ASolaraqProjectile>() : nullptr;
+    if (!ProjectileCDO || FireRate <= 0.0f)
+    {
+        return 0.0f;
+    }
+    return ProjectileCDO->BaseDamage / FireRate;
+}
+
+float ASolaraqShipBase::GetWeaponRange() const
+{
+    if (MainBeamWeapon)
+    {
+        return MainBeamWeapon->Range;
+    }
+    if (SalvoPattern)
+    {
+        return SalvoPattern->GetRange();
+    }
+
+    const ASolaraqProjectile* ProjectileCDO = ProjectileClass ? ProjectileClass->GetDefaultObject<ASolaraqProjectile>() : nullptr;
+    if (!ProjectileCDO)
+    {
+        return 0.0f;
+    }
+    return ProjectileMuzzleSpeed * ProjectileCDO->GetProjectileLifeSpan();
+}
+
+void ASolaraqShipBase::RestoreHealth(float NewHealth)
+{
+    if (!HasAuthority() || bIsDead)
+    {
+        return;
+    }
+    CurrentHealth = FMath::Clamp(NewHealth, 1.0f, MaxHealth);
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentHealth, this);
+}
+
 float ASolaraqShipBase::GetHealthPercentage() const
 {
     if (MaxHealth <= 0.0f)
@@ -284,6 +371,7 @@ void ASolaraqShipBase::BeginPlay()
 
     // Ensure energy starts at max on server and client
     CurrentEnergy = MaxEnergy;
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentEnergy, this);
 
     // Cache the initial scale of the visual mesh component
     if (ShipMeshComponent)
@@ -307,14 +395,54 @@ void ASolaraqShipBase::BeginPlay()
     {
         CurrentHealth = MaxHealth;
         bIsDead = false; // Double-check state
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentHealth, this);
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsDead, this);
     }
 
     // Reset energy (existing code)
     CurrentEnergy = MaxEnergy;
+
+    // Cache our team in the world registry so attitude queries don't need to cast
+    RefreshTeamRegistration();
+
+    MainBeamWeapon = USolaraqBeamWeaponComponent::FindBeamBelow(MuzzlePoint);
+
+    // Project our weapon threat onto the AI threat map
+    if (HasAuthority())
+    {
+        if (USolaraqThreatMapSubsystem* ThreatMap = USolaraqThreatMapSubsystem::Get(this))
+        {
+            ThreatSourceHandle = ThreatMap->RegisterSource(this, GetWeaponRange(), GetWeaponDamagePerSecond());
+        }
+
+        // Record our position history so remote shooters' hits can be checked against what they saw
+        if (USolaraqLagCompensationSubsystem* LagCompensation = USolaraqLagCompensationSubsystem::Get(this))
+        {
+            LagCompensationHandle = LagCompensation->RegisterShip(this);
+        }
+    }
     
     UE_LOG(LogSolaraqGeneral, Log, TEXT("ASolaraqShipBase %s BeginPlay called."), *GetName());
 }
 
+void ASolaraqShipBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this))
+    {
+        Teams->UnregisterTeamAgent(TeamHandle);
+    }
+    if (USolaraqThreatMapSubsystem* ThreatMap = USolaraqThreatMapSubsystem::Get(this))
+    {
+        ThreatMap->UnregisterSource(ThreatSourceHandle);
+    }
+    if (USolaraqLagCompensationSubsystem* LagCompensation = USolaraqLagCompensationSubsystem::Get(this))
+    {
+        LagCompensation->UnregisterShip(LagCompensationHandle);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void ASolaraqShipBase::ApplyVisualScale(float ScaleFactor)
 {
     // Optional: Optimization - Only apply if the scale factor has actually changed significantly
@@ -336,7 +464,11 @@ void ASolaraqShipBase::ApplyVisualScale(float ScaleFactor)
 void ASolaraqShipBase::Server_SetAttemptingBoost_Implementation(bool bAttempting)
 {
     // This runs ON THE SERVER
-    bIsAttemptingBoostInput = bAttempting;
+    if (bIsAttemptingBoostInput != bAttempting)
+    {
+        bIsAttemptingBoostInput = bAttempting;
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsAttemptingBoostInput, this);
+    }
     // Server Tick will now use this value to potentially set bIsBoosting
 }
 
@@ -436,6 +568,7 @@ void ASolaraqShipBase::Tick(float DeltaTime)
         if (bCanBoost != bIsBoosting)
         {
             bIsBoosting = bCanBoost;
+            SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsBoosting, this);
             if (!bIsBoosting) // If we just stopped boosting
             {
                 LastBoostStopTime = CurrentTime;
@@ -454,6 +587,7 @@ void ASolaraqShipBase::Tick(float DeltaTime)
         {
             CurrentEnergy -= EnergyDrainRate * DeltaTime;
             CurrentEnergy = FMath::Max(0.f, CurrentEnergy); // Clamp Min
+            SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentEnergy, this);
             if (CurrentEnergy == 0.f)
             {
                 UE_LOG(LogSolaraqMovement, Log, TEXT("Boost energy depleted."));
@@ -469,6 +603,7 @@ void ASolaraqShipBase::Tick(float DeltaTime)
                 {
                     CurrentEnergy += EnergyRegenRate * DeltaTime;
                     CurrentEnergy = FMath::Min(MaxEnergy, CurrentEnergy); // Clamp Max
+                    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentEnergy, this);
                 }
                 else // Energy is full, reset timer so we don't check every frame
                 {
@@ -622,6 +757,8 @@ void ASolaraqShipBase::DisableSystemsForDocking()
     // Stop boosting immediately if applicable
     bIsAttemptingBoostInput = false;
     bIsBoosting = false; // Ensure boost state is off
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsAttemptingBoostInput, this);
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsBoosting, this);
 
     // Other systems? Stop weapon charging, cancel scans, etc.
 }
@@ -664,48 +801,52 @@ FGenericTeamId ASolaraqShipBase::GetGenericTeamId() const
     return TeamId;
 }
 
-ETeamAttitude::Type ASolaraqShipBase::GetTeamAttitudeTowards(const AActor& Other) const
+void ASolaraqShipBase::SetGenericTeamId(const FGenericTeamId& NewTeamId)
 {
-    // If this pawn IS the player pawn:
-    if (const APawn* OtherPawn = Cast<const APawn>(&Other))
+    TeamId = NewTeamId;
+    if (HasActorBegunPlay())
     {
-        // Check the Other actor directly first
-        const IGenericTeamAgentInterface* OtherTeamAgentPawn = Cast<const IGenericTeamAgentInterface>(&Other);
-        if(OtherTeamAgentPawn)
-        {
-            if (OtherTeamAgentPawn->GetGenericTeamId() == GetGenericTeamId())
-            {
-                return ETeamAttitude::Friendly;
-            }
-            else if (OtherTeamAgentPawn->GetGenericTeamId().GetId() != FGenericTeamId::NoTeam.GetId())
-            {
-                return ETeamAttitude::Hostile; // Different valid team = Hostile
-            }
-        }
+        RefreshTeamRegistration();
+    }
+}
 
-        // If pawn check failed, check the Other actor's CONTROLLER
-        if (const IGenericTeamAgentInterface* OtherTeamAgentController = Cast<const IGenericTeamAgentInterface>(OtherPawn->GetController()))
-        {
-            if (OtherTeamAgentController->GetGenericTeamId() == GetGenericTeamId())
-            {
-                return ETeamAttitude::Friendly;
-            }
-            else if (OtherTeamAgentController->GetGenericTeamId().GetId() != FGenericTeamId::NoTeam.GetId())
-            {
-                return ETeamAttitude::Hostile; // Different valid team = Hostile
-            }
-        }
+ETeamAttitude::Type ASolaraqShipBase::GetTeamAttitudeTowards(const AActor& Other) const
+{
+    // Ships only take sides towards other pawns; projectiles, pickups and props stay neutral
+    if (!Other.IsA<APawn>())
+    {
+        return ETeamAttitude::Neutral;
+    }
 
-        // Fallback: If the other pawn is controlled by an AI Controller (and not handled above), treat as hostile?
-        if (Cast<AAIController>(OtherPawn->GetController()))
-        {
-            return ETeamAttitude::Hostile;
-        }
+    // Both teams come from the registry cache (controller team first, then pawn TeamId)
+    if (const USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this))
+    {
+        const FGenericTeamId MyTeam = TeamHandle.IsValid() ? Teams->GetTeamId(TeamHandle) : USolaraqTeamSubsystem::ResolveTeamIdSlow(*this);
+        return Teams->GetAttitudeTowards(MyTeam, Other);
     }
     // Default attitude
     return ETeamAttitude::Neutral;
 }
 
+void ASolaraqShipBase::NotifyControllerChanged()
+{
+    Super::NotifyControllerChanged();
+
+    // Possession changes the effective team (e.g. AI controller team 1 flying a ship with default TeamId 0)
+    if (HasActorBegunPlay())
+    {
+        RefreshTeamRegistration();
+    }
+}
+
+void ASolaraqShipBase::RefreshTeamRegistration()
+{
+    if (USolaraqTeamSubsystem* Teams = USolaraqTeamSubsystem::Get(this))
+    {
+        TeamHandle = Teams->RegisterTeamAgent(this, USolaraqTeamSubsystem::ResolveTeamIdSlow(*this));
+    }
+}
+
 void ASolaraqShipBase::OnRep_TurnInputForRoll()
 {
     // Called on Clients when CurrentTurnInputForRoll changes via replication.
@@ -752,18 +893,21 @@ bool ASolaraqShipBase::CollectPickup(EPickupType PickupType, int32 Quantity)
         case EPickupType::Resource_Iron:
             // TODO: Add inventory capacity check if needed
             CurrentIronCount += Quantity;
+            SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentIronCount, this);
             // OnRep_IronCount will be called automatically on clients due to replication
             UE_LOG(LogSolaraqSystem, Verbose, TEXT(" -> Added %d Iron. New Total: %d"), Quantity, CurrentIronCount);
             break;
 
         case EPickupType::Resource_Crystal:
             CurrentCrystalCount += Quantity;
+            SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentCrystalCount, this);
             UE_LOG(LogSolaraqSystem, Verbose, TEXT(" -> Added %d Crystal. New Total: %d"), Quantity, CurrentCrystalCount);
             break;
 
         case EPickupType::Ammo_Standard:
              // TODO: Add ammo capacity check if needed
             CurrentStandardAmmo += Quantity;
+            SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentStandardAmmo, this);
              UE_LOG(LogSolaraqSystem, Verbose, TEXT(" -> Added %d Standard Ammo. New Total: %d"), Quantity, CurrentStandardAmmo);
             break;
 
@@ -771,6 +915,7 @@ bool ASolaraqShipBase::CollectPickup(EPickupType PickupType, int32 Quantity)
             if (CurrentHealth < MaxHealth)
             {
                 CurrentHealth = FMath::Min(CurrentHealth + Quantity, MaxHealth); // Heal, clamp to max
+                SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentHealth, this);
                  UE_LOG(LogSolaraqSystem, Verbose, TEXT(" -> Healed %d HP. New Health: %.1f"), Quantity, CurrentHealth);
                  // OnRep_CurrentHealth will handle UI update
             }
@@ -812,6 +957,7 @@ void ASolaraqShipBase::SetTurnInputForRoll(float TurnValue)
         if(CurrentTurnInputForRoll != ClampedValue) // Check if changed
         {
             CurrentTurnInputForRoll = ClampedValue;
+            SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, CurrentTurnInputForRoll, this);
             // Server's local value is set, replication system will handle sending if changed.
         }
     }
@@ -832,6 +978,20 @@ void ASolaraqShipBase::PerformFireWeapon()
     if (!HasAuthority()) return;
     if (IsDead()) return;
 
+    // A beam on the muzzle stays on while fire requests keep coming
+    if (MainBeamWeapon)
+    {
+        MainBeamWeapon->SustainFire();
+        return;
+    }
+
+    // Ships with hardpoints fire their primary group instead of the single muzzle
+    if (Hardpoints && Hardpoints->HasSlots())
+    {
+        FireWeaponGroup(USolaraqHardpointComponent::PrimaryGroup);
+        return;
+    }
+
     // --- Check Cooldown ---
     const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f; // Safely get time
     if (CurrentTime < LastFireTime + FireRate)
@@ -840,6 +1000,13 @@ void ASolaraqShipBase::PerformFireWeapon()
         return;
     }
 
+    if (SalvoPattern)
+    {
+        FireSalvo();
+        LastFireTime = CurrentTime;
+        return;
+    }
+
     // --- Check Required Assets & Components ---
     if (!ProjectileClass)
     {
@@ -866,6 +1033,18 @@ void ASolaraqShipBase::PerformFireWeapon()
     const FVector MuzzleVelocity = MuzzleRotation.Vector() * ProjectileMuzzleSpeed; // Direction * Speed
     const FVector FinalVelocity = ShipVelocity + MuzzleVelocity;
 
+    // Guided missiles come from the pool and are steered by the missile subsystem
+    if (ProjectileClass->IsChildOf(ASolaraqHomingMissile::StaticClass()))
+    {
+        USolaraqMissileSubsystem* Missiles = USolaraqMissileSubsystem::Get(this);
+        const TSubclassOf<ASolaraqHomingMissile> MissileClass(ProjectileClass.Get());
+        if (Missiles && Missiles->LaunchMissile(MissileClass, FTransform(MuzzleRotation, MuzzleLocation), FinalVelocity, FindMissileTarget(), this, this))
+        {
+            LastFireTime = CurrentTime;
+        }
+        return;
+    }
+
     UE_LOG(LogSolaraqCombat, Warning, TEXT("%s PerformFireWeapon: Spawning %s. MuzzleLoc:%s Rot:%s ShipVel:%s MuzzleVel:%s FinalVel:%s"),
         *GetName(), *ProjectileClass->GetName(), *MuzzleLocation.ToString(), *MuzzleRotation.ToString(),
         *ShipVelocity.ToString(), *MuzzleVelocity.ToString(), *FinalVelocity.ToString());
@@ -906,6 +1085,38 @@ void ASolaraqShipBase::PerformFireWeapon()
     }
 }
 
+AActor* ASolaraqShipBase::FindMissileTarget() const
+{
+    if (const ASolaraqAIController* AIController = Cast<ASolaraqAIController>(GetController()))
+    {
+        return AIController->GetCurrentTarget();
+    }
+
+    const FVector Location = GetActorLocation();
+    const FVector Forward = GetActorForwardVector().GetSafeNormal2D();
+    const float MinCos = FMath::Cos(FMath::DegreesToRadians(MissileLockAngle));
+    float BestDistSq = FMath::Square(MissileLockRange);
+    AActor* BestTarget = nullptr;
+
+    for (TActorIterator<ASolaraqShipBase> It(GetWorld()); It; ++It)
+    {
+        ASolaraqShipBase* Ship = *It;
+        if (Ship == this || Ship->IsDead() || GetTeamAttitudeTowards(*Ship) != ETeamAttitude::Hostile)
+        {
+            continue;
+        }
+
+        const FVector ToShip = (Ship->GetActorLocation() - Location) * FVector(1.0f, 1.0f, 0.0f);
+        const float DistSq = ToShip.SizeSquared();
+        if (DistSq < BestDistSq && FVector::DotProduct(ToShip.GetSafeNormal(), Forward) >= MinCos)
+        {
+            BestDistSq = DistSq;
+            BestTarget = Ship;
+        }
+    }
+    return BestTarget;
+}
+
 void ASolaraqShipBase::Multicast_PlayDestructionEffects_Implementation()
 {
     // This runs on the Server AND all Clients
@@ -940,22 +1151,59 @@ void ASolaraqShipBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-    // Replicate these variables
-    DOREPLIFETIME(ASolaraqShipBase, CurrentEnergy);
-    DOREPLIFETIME(ASolaraqShipBase, bIsAttemptingBoostInput); // Replicate the *request*
-    DOREPLIFETIME(ASolaraqShipBase, bIsBoosting);            // Replicate the *actual* state
-    DOREPLIFETIME_CONDITION(ASolaraqShipBase, MaxEnergy, COND_InitialOnly); // Max energy likely won't change after spawn
-    DOREPLIFETIME(ASolaraqShipBase, bIsDocked);
-    DOREPLIFETIME(ASolaraqShipBase, DockedToPadComponent);
+    // Push model: only compared when the server marks them dirty (SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME at each write)
+    FDoRepLifetimeParams Params;
+    Params.bIsPushBased = true;
+
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, CurrentEnergy, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, bIsAttemptingBoostInput, Params); // Replicate the *request*
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, bIsBoosting, Params);            // Replicate the *actual* state
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, bIsDocked, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, DockedToPadComponent, Params);
     // Replicate Health and Death State
-    DOREPLIFETIME(ASolaraqShipBase, CurrentHealth);
-    DOREPLIFETIME(ASolaraqShipBase, bIsDead);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, CurrentHealth, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, bIsDead, Params);
     // Replicate the turn input value
-    DOREPLIFETIME(ASolaraqShipBase, CurrentTurnInputForRoll);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, CurrentTurnInputForRoll, Params);
     // Replicate Inventory Variables
-    DOREPLIFETIME(ASolaraqShipBase, CurrentIronCount);
-    DOREPLIFETIME(ASolaraqShipBase, CurrentCrystalCount);
-    DOREPLIFETIME(ASolaraqShipBase, CurrentStandardAmmo);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, CurrentIronCount, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, CurrentCrystalCount, Params);
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, CurrentStandardAmmo, Params);
+
+    Params.Condition = COND_InitialOnly;
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, MaxEnergy, Params); // Max energy likely won't change after spawn
+
+    // Timestamp for snapshot interpolation of ReplicatedMovement
+    Params.Condition = COND_SimulatedOnly;
+    DOREPLIFETIME_WITH_PARAMS_FAST(ASolaraqShipBase, ReplicatedMovementTime, Params);
+}
+
+void ASolaraqShipBase::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+    Super::PreReplication(ChangedPropertyTracker); // Gathers ReplicatedMovement
+
+    const FRepMovement& Movement = GetReplicatedMovement();
+    if (!Movement.Location.Equals(StampedMovementLocation) || !Movement.LinearVelocity.Equals(StampedMovementVelocity)
+        || !Movement.Rotation.Equals(StampedMovementRotation))
+    {
+        StampedMovementLocation = Movement.Location;
+        StampedMovementVelocity = Movement.LinearVelocity;
+        StampedMovementRotation = Movement.Rotation;
+        ReplicatedMovementTime = GetWorld()->GetTimeSeconds();
+        SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, ReplicatedMovementTime, this);
+    }
+}
+
+void ASolaraqShipBase::OnRep_ReplicatedMovement()
+{
+    // Other players' ships: buffer and interpolate instead of snapping the physics body to every update.
+    // Not while docked: the attachment places the ship and the interpolation is paused.
+    if (SnapshotInterpolation && !bIsDocked && SnapshotInterpolation->ConsumeSnapshot(ReplicatedMovementTime, GetReplicatedMovement()))
+    {
+        return;
+    }
+
+    Super::OnRep_ReplicatedMovement();
 }
 
 // --- Replication Notifiers ---
@@ -983,6 +1231,48 @@ void ASolaraqShipBase::Server_RequestFire_Implementation()
     PerformFireWeapon(); // Player request simply calls the core logic
 }
 
+void ASolaraqShipBase::FireSalvo()
+{
+    if (!HasAuthority() || !SalvoPattern || !MuzzlePoint)
+    {
+        return;
+    }
+
+    FSolaraqSalvoEvent SalvoEvent;
+    SalvoEvent.Pattern = SalvoPattern;
+    SalvoEvent.Seed = FMath::Rand();
+    SalvoEvent.Origin = MuzzlePoint->GetComponentLocation();
+    SalvoEvent.Direction = MuzzlePoint->GetForwardVector();
+    SalvoEvent.InheritedVelocity = CollisionAndPhysicsRoot ? CollisionAndPhysicsRoot->GetPhysicsLinearVelocity() : FVector::ZeroVector;
+    SalvoEvent.Quantize(); // The multicast runs locally with these exact values, clients get them quantized
+    Multicast_FireSalvo(SalvoEvent);
+}
+
+void ASolaraqShipBase::Multicast_FireSalvo_Implementation(const FSolaraqSalvoEvent& SalvoEvent)
+{
+    // Runs on the server too, which is the copy that applies damage
+    if (USolaraqSalvoSubsystem* Salvos = USolaraqSalvoSubsystem::Get(this))
+    {
+        Salvos->LaunchSalvo(SalvoEvent, this);
+    }
+}
+
+void ASolaraqShipBase::Server_RequestFireGroup_Implementation(uint8 GroupIndex)
+{
+    FireWeaponGroup(GroupIndex);
+}
+
+int32 ASolaraqShipBase::FireWeaponGroup(int32 GroupIndex)
+{
+    if (!HasAuthority() || IsDead() || !Hardpoints)
+    {
+        return 0;
+    }
+
+    const FVector ShipVelocity = CollisionAndPhysicsRoot ? CollisionAndPhysicsRoot->GetPhysicsLinearVelocity() : FVector::ZeroVector;
+    return Hardpoints->FireGroup(GroupIndex, ProjectileClass, ProjectileMuzzleSpeed, ShipVelocity);
+}
+
 void ASolaraqShipBase::OnRep_CurrentHealth()
 {
     // Called on clients when CurrentHealth changes.
@@ -1033,12 +1323,18 @@ void ASolaraqShipBase::HandleDestruction()
 
     // 1. Set the dead state (this will replicate via OnRep_IsDead)
     bIsDead = true;
+    SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ASolaraqShipBase, bIsDead, this);
     // Force Net Update to try and get the state change out quickly. May not be needed depending on NetUpdateFrequency.
     // ForceNetUpdate(); // Consider if needed, can increase bandwidth.
 
     // 2. Immediately trigger visual/audio effects on all clients via Multicast
     Multicast_PlayDestructionEffects();
 
+    if (MainBeamWeapon)
+    {
+        MainBeamWeapon->StopFiring();
+    }
+
     // 3. Disable ship functionality on the server
     // Stop physics simulation and movement
     if (CollisionAndPhysicsRoot)
@@ -0,0 +1,135 @@
+// SolaraqHomingMissile.cpp
+
+#include "Projectiles/SolaraqHomingMissile.h"
+#include "Projectiles/SolaraqMissileSubsystem.h"
+#include "Components/SphereComponent.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Net/UnrealNetwork.h"
+
+ASolaraqHomingMissile::ASolaraqHomingMissile()
+{
+    // The pool owns the missile's lifetime; USolaraqMissileSubsystem expires it after ProjectileLifeSpan
+    InitialLifeSpan = 0.0f;
+
+    // Clients fly the missile themselves from LaunchState
+    CollisionComp->SetIsReplicated(false);
+    ProjectileMovement->SetIsReplicated(false);
+    ProjectileMovement->InitialSpeed = 0.0f;
+    ProjectileMovement->MaxSpeed = 0.0f; // Guidance controls speed
+}
+
+void ASolaraqHomingMissile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ASolaraqHomingMissile, LaunchState);
+}
+
+void ASolaraqHomingMissile::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Covers clients that received LaunchState with the initial bunch, and hides freshly spawned server missiles
+    // until Launch
+    ApplyLaunchState();
+}
+
+void ASolaraqHomingMissile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (USolaraqMissileSubsystem* Subsystem = USolaraqMissileSubsystem::Get(this))
+    {
+        Subsystem->UnregisterGuidance(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASolaraqHomingMissile::DeactivateProjectile()
+{
+    USolaraqMissileSubsystem* Subsystem = USolaraqMissileSubsystem::Get(this);
+    if (Subsystem)
+    {
+        Subsystem->ReleaseMissile(this);
+    }
+    else
+    {
+        Super::DeactivateProjectile();
+    }
+}
+
+void ASolaraqHomingMissile::OnRep_LaunchState()
+{
+    ApplyLaunchState();
+}
+
+void ASolaraqHomingMissile::Launch(const FVector& Origin, const FVector& Velocity, AActor* Target)
+{
+    LaunchState.Target = Target;
+    LaunchState.Origin = Origin;
+    LaunchState.Velocity = Velocity;
+    LaunchState.bActive = true;
+    ++LaunchState.LaunchId;
+
+    SetNetDormancy(DORM_Awake);
+    ApplyLaunchState();
+    ForceNetUpdate();
+}
+
+void ASolaraqHomingMissile::Park()
+{
+    LaunchState.Target = nullptr;
+    LaunchState.bActive = false;
+
+    ApplyLaunchState();
+    ForceNetUpdate();
+    SetNetDormancy(DORM_DormantAll);
+}
+
+void ASolaraqHomingMissile::ApplyLaunchState()
+{
+    if (!HasActorBegunPlay())
+    {
+        return; // BeginPlay applies it
+    }
+
+    USolaraqMissileSubsystem* Subsystem = USolaraqMissileSubsystem::Get(this);
+
+    if (LaunchState.bActive)
+    {
+        if (AppliedLaunchId == LaunchState.LaunchId && GuidanceSlot != INDEX_NONE)
+        {
+            return; // Already flying this launch
+        }
+        AppliedLaunchId = LaunchState.LaunchId;
+
+        if (Subsystem)
+        {
+            Subsystem->UnregisterGuidance(this); // Relaunched before we saw it park
+        }
+
+        const FVector Velocity = LaunchState.Velocity;
+        SetActorLocationAndRotation(LaunchState.Origin, Velocity.Rotation(), false, nullptr, ETeleportType::TeleportPhysics);
+        ProjectileMovement->Velocity = Velocity;
+        ProjectileMovement->SetUpdatedComponent(CollisionComp);
+        ProjectileMovement->SetComponentTickEnabled(true);
+        SetActorHiddenInGame(false);
+        SetActorEnableCollision(true);
+
+        if (Subsystem)
+        {
+            Subsystem->RegisterGuidance(this);
+        }
+    }
+    else
+    {
+        if (Subsystem)
+        {
+            Subsystem->UnregisterGuidance(this);
+        }
+
+        ProjectileMovement->StopMovementImmediately();
+        ProjectileMovement->SetComponentTickEnabled(false);
+        SetActorHiddenInGame(true);
+        SetActorEnableCollision(false);
+    }
+}
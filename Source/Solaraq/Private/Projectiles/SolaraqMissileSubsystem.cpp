@@ -0,0 +1,231 @@
+// SolaraqMissileSubsystem.cpp
+
+#include "Projectiles/SolaraqMissileSubsystem.h"
+#include "Projectiles/SolaraqHomingMissile.h"
+#include "AI/SolaraqAIController.h"
+#include "Engine/World.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqMissileSubsystem* USolaraqMissileSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqMissileSubsystem>() : nullptr;
+}
+
+bool USolaraqMissileSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqMissileSubsystem::Deinitialize()
+{
+    for (ASolaraqHomingMissile* Missile : Missiles)
+    {
+        Missile->GuidanceSlot = INDEX_NONE;
+    }
+    Missiles.Empty();
+    Targets.Empty();
+    Velocities.Empty();
+    ExpireTimes.Empty();
+    Pool.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqMissileSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqMissileSubsystem, STATGROUP_Tickables);
+}
+
+// --- Pool ---
+
+ASolaraqHomingMissile* USolaraqMissileSubsystem::LaunchMissile(TSubclassOf<ASolaraqHomingMissile> MissileClass, const FTransform& SpawnTransform,
+    const FVector& Velocity, AActor* Target, AActor* Owner, APawn* Instigator)
+{
+    UWorld* World = GetWorld();
+    if (!MissileClass || !World || World->GetNetMode() == NM_Client)
+    {
+        return nullptr;
+    }
+
+    ASolaraqHomingMissile* Missile = nullptr;
+    if (TArray<TWeakObjectPtr<ASolaraqHomingMissile>>* Parked = Pool.Find(MissileClass.Get()))
+    {
+        while (!Missile && Parked->Num() > 0)
+        {
+            Missile = Parked->Pop(EAllowShrinking::No).Get();
+        }
+    }
+
+    if (Missile)
+    {
+        Missile->SetOwner(Owner);
+        Missile->SetInstigator(Instigator);
+    }
+    else
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Owner = Owner;
+        SpawnParams.Instigator = Instigator;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        Missile = World->SpawnActor<ASolaraqHomingMissile>(MissileClass, SpawnTransform, SpawnParams);
+        if (!Missile)
+        {
+            UE_LOG(LogSolaraqProjectile, Error, TEXT("Failed to spawn missile %s"), *GetNameSafe(MissileClass));
+            return nullptr;
+        }
+    }
+
+    Missile->Launch(SpawnTransform.GetLocation(), Velocity, Target);
+    return Missile;
+}
+
+void USolaraqMissileSubsystem::ReleaseMissile(ASolaraqHomingMissile* Missile)
+{
+    if (!Missile || !Missile->HasAuthority() || !Missile->IsLaunched())
+    {
+        return;
+    }
+
+    Missile->Park(); // Unregisters guidance
+
+    TArray<TWeakObjectPtr<ASolaraqHomingMissile>>& Parked = Pool.FindOrAdd(Missile->GetClass());
+    if (Parked.Num() < MaxPooledPerClass)
+    {
+        Parked.Add(Missile);
+    }
+    else
+    {
+        Missile->Destroy();
+    }
+}
+
+// --- Registration ---
+
+void USolaraqMissileSubsystem::RegisterGuidance(ASolaraqHomingMissile* Missile)
+{
+    if (!Missile || Missile->GuidanceSlot != INDEX_NONE)
+    {
+        return;
+    }
+
+    const double LifeSpan = Missile->GetProjectileLifeSpan();
+    Missile->GuidanceSlot = Missiles.Add(Missile);
+    Targets.Add(Missile->LaunchState.Target);
+    Velocities.Add(Missile->LaunchState.Velocity);
+    ExpireTimes.Add(LifeSpan > 0.0 ? GetWorld()->GetTimeSeconds() + LifeSpan : TNumericLimits<double>::Max());
+}
+
+void USolaraqMissileSubsystem::UnregisterGuidance(ASolaraqHomingMissile* Missile)
+{
+    if (Missile && Missiles.IsValidIndex(Missile->GuidanceSlot) && Missiles[Missile->GuidanceSlot] == Missile)
+    {
+        RemoveSlot(Missile->GuidanceSlot);
+    }
+}
+
+void USolaraqMissileSubsystem::RemoveSlot(int32 Slot)
+{
+    Missiles[Slot]->GuidanceSlot = INDEX_NONE;
+    Missiles.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Targets.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Velocities.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    ExpireTimes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    if (Missiles.IsValidIndex(Slot))
+    {
+        Missiles[Slot]->GuidanceSlot = Slot;
+    }
+}
+
+// --- Guidance ---
+
+void USolaraqMissileSubsystem::Tick(float DeltaTime)
+{
+    if (Missiles.Num() == 0 || DeltaTime <= 0.0f)
+    {
+        return;
+    }
+
+    const UWorld* World = GetWorld();
+    const double Now = World->GetTimeSeconds();
+    const bool bAuthority = World->GetNetMode() != NM_Client;
+
+    // Expire first (server); parking swaps the last missile into the slot, so walk backwards
+    if (bAuthority)
+    {
+        for (int32 Index = Missiles.Num() - 1; Index >= 0; --Index)
+        {
+            if (Now >= ExpireTimes[Index])
+            {
+                ReleaseMissile(Missiles[Index]);
+            }
+        }
+    }
+
+    // 1. Gather
+    const int32 Num = Missiles.Num();
+    Positions.SetNumUninitialized(Num);
+    TargetPositions.SetNumUninitialized(Num);
+    TargetVelocities.SetNumUninitialized(Num);
+    HasTarget.SetNumUninitialized(Num);
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        Positions[Index] = Missiles[Index]->GetActorLocation();
+        const AActor* Target = Targets[Index].Get();
+        HasTarget[Index] = Target != nullptr;
+        if (Target)
+        {
+            TargetPositions[Index] = Target->GetActorLocation();
+            TargetVelocities[Index] = Target->GetVelocity();
+        }
+    }
+
+    // 2. Proportional navigation (yaw only, ships live on a plane)
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        const ASolaraqHomingMissile* Missile = Missiles[Index];
+        FVector& Velocity = Velocities[Index];
+        const float Speed = Missile->MissileSpeed;
+        const float MaxTurn = FMath::DegreesToRadians(Missile->MaxTurnRate) * DeltaTime;
+        float Heading = FMath::Atan2(Velocity.Y, Velocity.X);
+
+        if (HasTarget[Index])
+        {
+            const FVector ToTarget = TargetPositions[Index] - Positions[Index];
+            const FVector RelativeVelocity = TargetVelocities[Index] - Velocity;
+            const float RangeSq = FMath::Max(ToTarget.SizeSquared2D(), 1.0f);
+            const float ClosingSpeed = -(ToTarget.X * RelativeVelocity.X + ToTarget.Y * RelativeVelocity.Y) / FMath::Sqrt(RangeSq);
+
+            float TurnRequest;
+            if (ClosingSpeed > 0.0f)
+            {
+                // Line-of-sight rate from relative kinematics, no history needed
+                const float LineOfSightRate = (ToTarget.X * RelativeVelocity.Y - ToTarget.Y * RelativeVelocity.X) / RangeSq;
+                TurnRequest = Missile->NavigationConstant * LineOfSightRate * DeltaTime;
+            }
+            else
+            {
+                // Not closing yet (launch, overshoot): point at the lead point
+                FVector AimPoint = TargetPositions[Index];
+                ASolaraqAIController::CalculateInterceptPoint(Positions[Index], FVector::ZeroVector, TargetPositions[Index], TargetVelocities[Index], Speed, AimPoint);
+                const FVector ToAim = AimPoint - Positions[Index];
+                TurnRequest = FMath::FindDeltaAngleRadians(Heading, FMath::Atan2(ToAim.Y, ToAim.X));
+            }
+            Heading += FMath::Clamp(TurnRequest, -MaxTurn, MaxTurn);
+        }
+
+        // Converge on cruise speed (launch velocity includes the shooter's velocity)
+        const float CurrentSpeed = FMath::FInterpTo(Velocity.Size2D(), Speed, DeltaTime, 2.0f);
+        Velocity = FVector(FMath::Cos(Heading), FMath::Sin(Heading), 0.0f) * CurrentSpeed;
+    }
+
+    // 3. Write back
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        if (UProjectileMovementComponent* Movement = Missiles[Index]->GetProjectileMovement())
+        {
+            Movement->Velocity = Velocities[Index];
+        }
+    }
+}
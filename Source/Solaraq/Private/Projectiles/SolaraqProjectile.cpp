@@ -12,6 +12,9 @@
 #include "Pawns/SolaraqShipBase.h"       // Adjust path as needed
 #include "Logging/SolaraqLogChannels.h" // Adjust path as needed
 #include "Net/UnrealNetwork.h"          // For HasAuthority()
+#include "Benchmark/SolaraqBenchmarkStats.h"
+#include "Gameplay/Combat/SolaraqDamageSubsystem.h"
+#include "Projectiles/SolaraqProjectileGravitySubsystem.h"
 
 // Sets default values
 ASolaraqProjectile::ASolaraqProjectile()
@@ -53,6 +56,13 @@ ASolaraqProjectile::ASolaraqProjectile()
     BaseDamage = 25.0f;
 }
 
+void ASolaraqProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+    DOREPLIFETIME(ASolaraqProjectile, BallisticLaunch);
+}
+
 void ASolaraqProjectile::SetBaseDamage(float NewDamage)
 {
     BaseDamage = NewDamage;
@@ -64,6 +74,9 @@ void ASolaraqProjectile::BeginPlay()
 {
     Super::BeginPlay();
 
+    ++SolaraqBenchmark::GCounters.LiveProjectiles;
+    ++SolaraqBenchmark::GCounters.ProjectilesSpawned;
+
     // Bind the OnHit function AFTER components are created and initialized
     if (CollisionComp)
     {
@@ -76,10 +89,58 @@ void ASolaraqProjectile::BeginPlay()
         UE_LOG(LogSolaraqProjectile, Error, TEXT("Projectile %s: CollisionComp is NULL in BeginPlay! Cannot bind OnOverlapBegin."), *GetName());
     }
 
+    // Gravity projectiles are moved by USolaraqProjectileGravitySubsystem, not the movement component
+    if (bAffectedByCelestialGravity && ProjectileMovement)
+    {
+        ProjectileMovement->SetComponentTickEnabled(false);
+        if (HasAuthority())
+        {
+            if (USolaraqProjectileGravitySubsystem* Gravity = USolaraqProjectileGravitySubsystem::Get(this))
+            {
+                Gravity->QueueLaunch(this);
+            }
+        }
+        else
+        {
+            ApplyBallisticLaunch(); // Launch may have arrived with the initial bunch
+        }
+    }
+
     UE_LOG(LogSolaraqProjectile, Log, TEXT("Projectile %s Spawned. InitialSpeed: %.1f, LifeSpan: %.1f"),
         *GetName(), ProjectileMovement ? ProjectileMovement->InitialSpeed : -1.f, InitialLifeSpan);
 }
 
+void ASolaraqProjectile::OnRep_BallisticLaunch()
+{
+    ApplyBallisticLaunch();
+}
+
+void ASolaraqProjectile::ApplyBallisticLaunch()
+{
+    if (!bAffectedByCelestialGravity || !BallisticLaunch.IsSet() || !HasActorBegunPlay())
+    {
+        return;
+    }
+
+    if (USolaraqProjectileGravitySubsystem* Gravity = USolaraqProjectileGravitySubsystem::Get(this))
+    {
+        Gravity->RegisterProjectile(this);
+    }
+}
+
+void ASolaraqProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    --SolaraqBenchmark::GCounters.LiveProjectiles;
+    if (GravitySlot != INDEX_NONE)
+    {
+        if (USolaraqProjectileGravitySubsystem* Gravity = USolaraqProjectileGravitySubsystem::Get(this))
+        {
+            Gravity->UnregisterProjectile(this);
+        }
+    }
+    Super::EndPlay(EndPlayReason);
+}
+
 void ASolaraqProjectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
     UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
@@ -98,14 +159,12 @@ void ASolaraqProjectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent
             {
                 TSubclassOf<UDamageType> DmgTypeClass = DamageTypeClass ? DamageTypeClass : TSubclassOf<UDamageType>(UDamageType::StaticClass());
 
-                // Use SweepResult for FPointDamageEvent.
-                // SweepResult.ImpactNormal can be used for the ShotDirection.
-                FPointDamageEvent DamageEvent(BaseDamage, SweepResult, SweepResult.ImpactNormal, DmgTypeClass);
-
+                // Use SweepResult for the point damage; SweepResult.ImpactNormal serves as the ShotDirection.
+                // Queued: all hits on this ship this frame are applied together at the end of the frame.
                 AController* InstigatorController = GetInstigatorController();
-                UE_LOG(LogSolaraqProjectile, Log, TEXT("Server: Applying %.1f PointDamage to %s from %s (Instigator: %s) via Overlap"),
+                UE_LOG(LogSolaraqProjectile, Verbose, TEXT("Server: Queuing %.1f PointDamage to %s from %s (Instigator: %s) via Overlap"),
                        BaseDamage, *OtherActor->GetName(), *GetNameSafe(this), *GetNameSafe(InstigatorController));
-                OtherActor->TakeDamage(BaseDamage, DamageEvent, InstigatorController, this);
+                USolaraqDamageSubsystem::QueuePointDamage(OtherActor, BaseDamage, SweepResult, SweepResult.ImpactNormal, DmgTypeClass, InstigatorController, this);
             }
         }
         else
@@ -120,7 +179,7 @@ void ASolaraqProjectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent
         if (HasAuthority())
         {
              UE_LOG(LogSolaraqProjectile, Verbose, TEXT("Server: Destroying projectile %s after overlap."), *GetName());
-            Destroy();
+            DeactivateProjectile();
         }
         else // Client-side cleanup if needed before server destruction
         {
@@ -130,3 +189,8 @@ void ASolaraqProjectile::OnOverlapBegin(UPrimitiveComponent* OverlappedComponent
         }
     }
 }
+
+void ASolaraqProjectile::DeactivateProjectile()
+{
+    Destroy();
+}
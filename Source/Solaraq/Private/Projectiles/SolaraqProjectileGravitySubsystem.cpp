@@ -0,0 +1,234 @@
+// SolaraqProjectileGravitySubsystem.cpp
+
+#include "Projectiles/SolaraqProjectileGravitySubsystem.h"
+#include "Projectiles/SolaraqProjectile.h"
+#include "Components/SphereComponent.h"
+#include "Environment/CelestialBodyBase.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "Logging/SolaraqLogChannels.h"
+
+namespace
+{
+    /** Same rounding FVector_NetQuantize100 applies on the wire, so the server simulates what clients receive. */
+    FVector QuantizeNet100(const FVector& Value)
+    {
+        return FVector(FMath::RoundToDouble(Value.X * 100.0) / 100.0,
+                       FMath::RoundToDouble(Value.Y * 100.0) / 100.0,
+                       FMath::RoundToDouble(Value.Z * 100.0) / 100.0);
+    }
+}
+
+USolaraqProjectileGravitySubsystem* USolaraqProjectileGravitySubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqProjectileGravitySubsystem>() : nullptr;
+}
+
+bool USolaraqProjectileGravitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqProjectileGravitySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Bodies don't move; gather them once (placed in the level, so clients see the same set).
+    // Bodies haven't begun play yet, so the radius has to come from GetInfluenceDistance (not a BeginPlay cache).
+    for (TActorIterator<ACelestialBodyBase> It(&InWorld); It; ++It)
+    {
+        if (It->GetGravitationalStrength() == 0.0f)
+        {
+            continue;
+        }
+
+        const float InfluenceDistance = It->GetInfluenceDistance();
+        if (InfluenceDistance <= 0.0f)
+        {
+            UE_LOG(LogSolaraqProjectile, Warning, TEXT("ProjectileGravity: %s has gravity but no influence radius, ignored."), *It->GetName());
+            continue;
+        }
+
+        BodyPositions.Add(It->GetActorLocation());
+        BodyRadii.Add(InfluenceDistance);
+        BodyStrengths.Add(It->GetGravitationalStrength());
+        BodyExponents.Add(It->GetGravityFalloffExponent());
+    }
+
+    UE_LOG(LogSolaraqProjectile, Log, TEXT("ProjectileGravity: %d celestial bodies."), BodyPositions.Num());
+}
+
+void USolaraqProjectileGravitySubsystem::Deinitialize()
+{
+    for (ASolaraqProjectile* Projectile : Projectiles)
+    {
+        Projectile->GravitySlot = INDEX_NONE;
+    }
+    Projectiles.Empty();
+    Positions.Empty();
+    Velocities.Empty();
+    SimTimes.Empty();
+    GravityScales.Empty();
+    BodyPositions.Empty();
+    BodyRadii.Empty();
+    BodyStrengths.Empty();
+    BodyExponents.Empty();
+    PendingLaunches.Empty();
+
+    Super::Deinitialize();
+}
+
+TStatId USolaraqProjectileGravitySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqProjectileGravitySubsystem, STATGROUP_Tickables);
+}
+
+double USolaraqProjectileGravitySubsystem::GetServerTime() const
+{
+    const UWorld* World = GetWorld();
+    const AGameStateBase* GameState = World->GetGameState();
+    return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+// --- Registration ---
+
+void USolaraqProjectileGravitySubsystem::QueueLaunch(ASolaraqProjectile* Projectile)
+{
+    if (Projectile)
+    {
+        PendingLaunches.Emplace(Projectile, GetServerTime());
+    }
+}
+
+void USolaraqProjectileGravitySubsystem::RegisterProjectile(ASolaraqProjectile* Projectile)
+{
+    if (!Projectile || Projectile->GravitySlot != INDEX_NONE || !Projectile->BallisticLaunch.IsSet())
+    {
+        return;
+    }
+
+    const FSolaraqBallisticLaunch& Launch = Projectile->BallisticLaunch;
+    const int32 Index = Projectiles.Add(Projectile);
+    Projectile->GravitySlot = Index;
+    Positions.Add(Launch.Origin);
+    Velocities.Add(Launch.Velocity);
+    SimTimes.Add(Launch.LaunchTime);
+    GravityScales.Add(Projectile->CelestialGravityScale);
+
+    if (GridStep < 0)
+    {
+        GridStep = FMath::FloorToInt64(GetServerTime() * FixedStepRate);
+    }
+
+    // Clients receive the launch late; replay the same steps the server took to reach the current grid point
+    for (int64 Step = FMath::FloorToInt64(Launch.LaunchTime * FixedStepRate) + 1; Step <= GridStep; ++Step)
+    {
+        IntegrateTo(Index, GetStepTime(Step));
+    }
+}
+
+void USolaraqProjectileGravitySubsystem::UnregisterProjectile(ASolaraqProjectile* Projectile)
+{
+    if (Projectile && Projectiles.IsValidIndex(Projectile->GravitySlot) && Projectiles[Projectile->GravitySlot] == Projectile)
+    {
+        RemoveSlot(Projectile->GravitySlot);
+    }
+}
+
+void USolaraqProjectileGravitySubsystem::RemoveSlot(int32 Slot)
+{
+    Projectiles[Slot]->GravitySlot = INDEX_NONE;
+    Projectiles.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Positions.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    Velocities.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    SimTimes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    GravityScales.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+    if (Projectiles.IsValidIndex(Slot))
+    {
+        Projectiles[Slot]->GravitySlot = Slot;
+    }
+}
+
+// --- Simulation ---
+
+void USolaraqProjectileGravitySubsystem::IntegrateTo(int32 Index, double ToTime)
+{
+    const float StepSize = static_cast<float>(ToTime - SimTimes[Index]);
+    if (StepSize <= 0.0f)
+    {
+        return;
+    }
+
+    const FVector Position = Positions[Index];
+    FVector Acceleration = FVector::ZeroVector;
+    for (int32 Body = 0; Body < BodyPositions.Num(); ++Body)
+    {
+        // Matches ACelestialBodyBase::CalculateGravityForce
+        const FVector ToBody = BodyPositions[Body] - Position;
+        const float Distance = ToBody.Size();
+        if (Distance < KINDA_SMALL_NUMBER || Distance >= BodyRadii[Body])
+        {
+            continue;
+        }
+        const float Magnitude = BodyStrengths[Body] * FMath::Pow(1.0f - Distance / BodyRadii[Body], BodyExponents[Body]);
+        Acceleration += ToBody * (Magnitude / Distance);
+    }
+
+    Velocities[Index] += Acceleration * (GravityScales[Index] * StepSize);
+    Positions[Index] = Position + Velocities[Index] * StepSize;
+    SimTimes[Index] = ToTime;
+}
+
+void USolaraqProjectileGravitySubsystem::Tick(float DeltaTime)
+{
+    // Server: pin down this frame's launches (spawn code has set the velocity by now)
+    for (const TPair<TWeakObjectPtr<ASolaraqProjectile>, double>& Pending : PendingLaunches)
+    {
+        ASolaraqProjectile* Projectile = Pending.Key.Get();
+        if (!Projectile)
+        {
+            continue;
+        }
+
+        FSolaraqBallisticLaunch& Launch = Projectile->BallisticLaunch;
+        Launch.Origin = QuantizeNet100(Projectile->GetActorLocation());
+        Launch.Velocity = QuantizeNet100(Projectile->GetProjectileMovement()->Velocity);
+        Launch.LaunchTime = Pending.Value;
+        RegisterProjectile(Projectile);
+    }
+    PendingLaunches.Reset();
+
+    if (Projectiles.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = GetServerTime();
+
+    // One pass over all projectiles per grid step
+    for (int32 StepCount = 0; StepCount < MaxStepsPerFrame && GetStepTime(GridStep + 1) <= Now; ++StepCount)
+    {
+        ++GridStep;
+        const double StepTime = GetStepTime(GridStep);
+        for (int32 Index = 0; Index < Projectiles.Num(); ++Index)
+        {
+            if (SimTimes[Index] < StepTime)
+            {
+                IntegrateTo(Index, StepTime);
+            }
+        }
+    }
+
+    // Place actors at the simulated state extrapolated to now; the sweep raises overlaps along the way
+    for (int32 Index = Projectiles.Num() - 1; Index >= 0; --Index)
+    {
+        ASolaraqProjectile* Projectile = Projectiles[Index];
+        const FVector& Velocity = Velocities[Index];
+        const float Ahead = FMath::Max(static_cast<float>(Now - SimTimes[Index]), 0.0f);
+        Projectile->GetCollisionComp()->ComponentVelocity = Velocity;
+        Projectile->SetActorLocationAndRotation(Positions[Index] + Velocity * Ahead, Velocity.Rotation(), true);
+    }
+}
@@ -0,0 +1,281 @@
+// SolaraqSalvoSubsystem.cpp
+
+#include "Projectiles/SolaraqSalvoSubsystem.h"
+#include "Pawns/SolaraqShipBase.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/DamageType.h"
+#include "Gameplay/Combat/SolaraqDamageSubsystem.h"
+#include "Gameplay/SolaraqCollisionChannels.h"
+#include "Logging/SolaraqLogChannels.h"
+
+USolaraqSalvoSubsystem* USolaraqSalvoSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    return World ? World->GetSubsystem<USolaraqSalvoSubsystem>() : nullptr;
+}
+
+bool USolaraqSalvoSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USolaraqSalvoSubsystem::Deinitialize()
+{
+    Salvos.Empty();
+    PelletMeshComponents.Empty();
+    VisualTransforms.Empty();
+    VisualsActor = nullptr;
+    Super::Deinitialize();
+}
+
+TStatId USolaraqSalvoSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USolaraqSalvoSubsystem, STATGROUP_Tickables);
+}
+
+void USolaraqSalvoSubsystem::LaunchSalvo(const FSolaraqSalvoEvent& Event, AActor* Shooter)
+{
+    if (!Event.Pattern)
+    {
+        return;
+    }
+
+    if (Salvos.Num() >= MaxActiveSalvos)
+    {
+        UE_LOG(LogSolaraqCombat, Verbose, TEXT("Salvo limit (%d) reached, dropping oldest"), MaxActiveSalvos);
+        Salvos.RemoveAt(0, 1, EAllowShrinking::No);
+    }
+
+    FSolaraqActiveSalvo& Salvo = Salvos.AddDefaulted_GetRef();
+    Salvo.Pattern = Event.Pattern;
+    Salvo.Shooter = Shooter;
+    Salvo.Origin = Event.Origin;
+    Salvo.StartTime = GetWorld()->GetTimeSeconds();
+    Salvo.bApplyDamage = Shooter && Shooter->HasAuthority();
+    Event.Pattern->GeneratePelletVelocities(Event.Seed, Event.Direction, Event.InheritedVelocity, Salvo.Velocities);
+    Salvo.Alive.Init(true, Salvo.Velocities.Num());
+    Salvo.NumAlive = Salvo.Velocities.Num();
+}
+
+// --- Simulation ---
+
+void USolaraqSalvoSubsystem::Tick(float DeltaTime)
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+
+    for (int32 Index = Salvos.Num() - 1; Index >= 0; --Index)
+    {
+        FSolaraqActiveSalvo& Salvo = Salvos[Index];
+        const float Lifetime = Salvo.Pattern ? Salvo.Pattern->PelletLifetime : 0.0f;
+        const float FlightTime = FMath::Min(static_cast<float>(Now - Salvo.StartTime), Lifetime);
+
+        if (FlightTime > Salvo.SimulatedTime && Salvo.NumAlive > 0)
+        {
+            ResolveHits(Salvo, Salvo.SimulatedTime, FlightTime);
+            Salvo.SimulatedTime = FlightTime;
+        }
+
+        if (Salvo.NumAlive == 0 || FlightTime >= Lifetime)
+        {
+            Salvos.RemoveAt(Index, 1, EAllowShrinking::No); // Keep launch order, LaunchSalvo drops from the front
+        }
+    }
+
+    if (!IsRunningDedicatedServer())
+    {
+        UpdateVisuals(Now);
+    }
+}
+
+void USolaraqSalvoSubsystem::ResolveHits(FSolaraqActiveSalvo& Salvo, float FromTime, float ToTime)
+{
+    const USolaraqSalvoPattern& Pattern = *Salvo.Pattern;
+
+    // Bounds of every live pellet's segment this frame
+    FBox SweepBounds(ForceInit);
+    for (TConstSetBitIterator<> It(Salvo.Alive); It; ++It)
+    {
+        const FVector& Velocity = Salvo.Velocities[It.GetIndex()];
+        SweepBounds += Salvo.Origin + Velocity * FromTime;
+        SweepBounds += Salvo.Origin + Velocity * ToTime;
+    }
+    SweepBounds = SweepBounds.ExpandBy(Pattern.PelletRadius);
+
+    // One broadphase query for the whole salvo on the Projectile channel, so it finds exactly what a regular
+    // projectile would: ships and world geometry, but not trigger volumes that ignore projectiles (influence spheres, pickups)
+    FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(SolaraqSalvoSweep), false);
+    if (AActor* Shooter = Salvo.Shooter.Get())
+    {
+        QueryParams.AddIgnoredActor(Shooter);
+    }
+    OverlapScratch.Reset();
+    GetWorld()->OverlapMultiByChannel(OverlapScratch, SweepBounds.GetCenter(), FQuat::Identity,
+        ECC_SolaraqProjectile, FCollisionShape::MakeBox(SweepBounds.GetExtent()), QueryParams);
+    if (OverlapScratch.IsEmpty())
+    {
+        return;
+    }
+
+    // Keep only the earliest hit per pellet, so a ship behind an asteroid stays covered
+    PelletHitScratch.Reset();
+    PelletHitScratch.SetNum(Salvo.Velocities.Num());
+
+    for (const FOverlapResult& Overlap : OverlapScratch)
+    {
+        AActor* HitActor = Overlap.GetActor();
+        UPrimitiveComponent* HitComponent = Overlap.GetComponent();
+        if (!HitActor || !HitComponent || HitComponent->GetCollisionResponseToChannel(ECC_SolaraqProjectile) == ECR_Ignore)
+        {
+            continue;
+        }
+
+        // Ships are tested as spheres, the same as every other weapon's hit radius
+        ASolaraqShipBase* Ship = Cast<ASolaraqShipBase>(HitActor);
+        if (Ship && Ship->IsDead())
+        {
+            continue;
+        }
+        const FVector ShipLocation = Ship ? Ship->GetActorLocation() : FVector::ZeroVector;
+        const float HitRadiusSq = Ship ? FMath::Square(Ship->GetSimpleCollisionRadius() + Pattern.PelletRadius) : 0.0f;
+
+        for (TConstSetBitIterator<> It(Salvo.Alive); It; ++It)
+        {
+            const int32 PelletIndex = It.GetIndex();
+            const FVector Start = Salvo.Origin + Salvo.Velocities[PelletIndex] * FromTime;
+            const FVector End = Salvo.Origin + Salvo.Velocities[PelletIndex] * ToTime;
+            FPelletHit& PelletHit = PelletHitScratch[PelletIndex];
+
+            if (Ship)
+            {
+                if (FMath::PointDistToSegmentSquared(ShipLocation, Start, End) > HitRadiusSq)
+                {
+                    continue;
+                }
+                const FVector ImpactPoint = FMath::ClosestPointOnSegment(ShipLocation, Start, End);
+                const float Time = (ImpactPoint - Start).Size() / FMath::Max((End - Start).Size(), UE_KINDA_SMALL_NUMBER);
+                if (Time < PelletHit.Time)
+                {
+                    PelletHit = { Time, Ship, HitComponent, ImpactPoint };
+                }
+            }
+            else
+            {
+                // Asteroids, planets and destructibles: trace the segment against the overlapped component only
+                FHitResult ComponentHit;
+                if (HitComponent->LineTraceComponent(ComponentHit, Start, End, QueryParams) && ComponentHit.Time < PelletHit.Time)
+                {
+                    PelletHit = { ComponentHit.Time, HitActor, HitComponent, ComponentHit.ImpactPoint };
+                }
+            }
+        }
+    }
+
+    AActor* Shooter = Salvo.Shooter.Get();
+    for (int32 PelletIndex = 0; PelletIndex < PelletHitScratch.Num(); ++PelletIndex)
+    {
+        const FPelletHit& PelletHit = PelletHitScratch[PelletIndex];
+        if (!PelletHit.Actor)
+        {
+            continue;
+        }
+
+        Salvo.Alive[PelletIndex] = false;
+        --Salvo.NumAlive;
+
+        if (Salvo.bApplyDamage && Pattern.DamagePerPellet > 0.0f)
+        {
+            const FVector ShotDirection = Salvo.Velocities[PelletIndex].GetSafeNormal();
+            const FHitResult Hit(PelletHit.Actor, PelletHit.Component, PelletHit.ImpactPoint, -ShotDirection);
+            USolaraqDamageSubsystem::QueuePointDamage(PelletHit.Actor, Pattern.DamagePerPellet, Hit, ShotDirection, UDamageType::StaticClass(),
+                Shooter ? Shooter->GetInstigatorController() : nullptr, Shooter);
+        }
+    }
+}
+
+// --- Visuals ---
+
+UInstancedStaticMeshComponent* USolaraqSalvoSubsystem::GetOrCreatePelletMeshComponent(UStaticMesh* Mesh)
+{
+    if (TObjectPtr<UInstancedStaticMeshComponent>* Existing = PelletMeshComponents.Find(Mesh))
+    {
+        return *Existing;
+    }
+
+    if (!VisualsActor)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags |= RF_Transient;
+        VisualsActor = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!VisualsActor)
+        {
+            return nullptr;
+        }
+    }
+
+    UInstancedStaticMeshComponent* MeshComponent = NewObject<UInstancedStaticMeshComponent>(VisualsActor);
+    MeshComponent->SetStaticMesh(Mesh);
+    MeshComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    MeshComponent->SetCastShadow(false);
+    if (USceneComponent* Root = VisualsActor->GetRootComponent())
+    {
+        MeshComponent->SetupAttachment(Root);
+    }
+    else
+    {
+        VisualsActor->SetRootComponent(MeshComponent);
+    }
+    MeshComponent->RegisterComponent();
+
+    PelletMeshComponents.Add(Mesh, MeshComponent);
+    return MeshComponent;
+}
+
+void USolaraqSalvoSubsystem::UpdateVisuals(double Now)
+{
+    for (TPair<UStaticMesh*, TArray<FTransform>>& Entry : VisualTransforms)
+    {
+        Entry.Value.Reset();
+    }
+
+    for (const FSolaraqActiveSalvo& Salvo : Salvos)
+    {
+        if (!Salvo.Pattern || !Salvo.Pattern->PelletMesh)
+        {
+            continue;
+        }
+
+        TArray<FTransform>& Transforms = VisualTransforms.FindOrAdd(Salvo.Pattern->PelletMesh);
+        const float FlightTime = static_cast<float>(Now - Salvo.StartTime);
+        for (TConstSetBitIterator<> It(Salvo.Alive); It; ++It)
+        {
+            const FVector& Velocity = Salvo.Velocities[It.GetIndex()];
+            Transforms.Emplace(Velocity.Rotation(), Salvo.Origin + Velocity * FlightTime, Salvo.Pattern->PelletMeshScale);
+        }
+    }
+
+    for (TPair<UStaticMesh*, TArray<FTransform>>& Entry : VisualTransforms)
+    {
+        UInstancedStaticMeshComponent* MeshComponent = GetOrCreatePelletMeshComponent(Entry.Key);
+        if (!MeshComponent)
+        {
+            continue;
+        }
+
+        if (MeshComponent->GetInstanceCount() == Entry.Value.Num())
+        {
+            if (Entry.Value.Num() > 0)
+            {
+                MeshComponent->BatchUpdateInstancesTransforms(0, Entry.Value, true, true);
+            }
+        }
+        else
+        {
+            MeshComponent->ClearInstances();
+            MeshComponent->AddInstances(Entry.Value, false, true);
+        }
+    }
+}
@@ -0,0 +1,54 @@
+// SolaraqSalvoTypes.cpp
+
+#include "Projectiles/SolaraqSalvoTypes.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+
+void USolaraqSalvoPattern::GeneratePelletVelocities(int32 Seed, const FVector& Direction, const FVector& InheritedVelocity, TArray<FVector>& OutVelocities) const
+{
+    // Only FRandomStream draws, in a fixed order, so clients reproduce the server's pellets exactly
+    FRandomStream Stream(Seed);
+    const float HalfSpread = SpreadAngle * 0.5f;
+    const float Spacing = PelletCount > 1 ? SpreadAngle / (PelletCount - 1) : 0.0f;
+    const FVector Forward = FVector(Direction.X, Direction.Y, 0.0f).GetSafeNormal();
+
+    OutVelocities.Reset(PelletCount);
+    for (int32 Index = 0; Index < PelletCount; ++Index)
+    {
+        float YawOffset;
+        if (bEvenSpread)
+        {
+            const float Center = PelletCount > 1 ? -HalfSpread + Spacing * Index : 0.0f;
+            YawOffset = Center + Stream.FRandRange(-0.5f, 0.5f) * Spacing * SpreadJitter;
+        }
+        else
+        {
+            YawOffset = Stream.FRandRange(-HalfSpread, HalfSpread);
+        }
+        const float Speed = PelletSpeed * Stream.FRandRange(1.0f - SpeedVariance, 1.0f + SpeedVariance);
+
+        OutVelocities.Add(InheritedVelocity + Forward.RotateAngleAxis(YawOffset, FVector::UpVector) * Speed);
+    }
+}
+
+namespace
+{
+    /** Write then read back through the type's own NetSerialize, which is exactly what a client receives. */
+    template <typename VectorType>
+    void RoundTripNetSerialize(VectorType& Vector)
+    {
+        bool bSuccess = true;
+        FBitWriter Writer(256, true);
+        Vector.NetSerialize(Writer, nullptr, bSuccess);
+
+        FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+        Vector.NetSerialize(Reader, nullptr, bSuccess);
+    }
+}
+
+void FSolaraqSalvoEvent::Quantize()
+{
+    RoundTripNetSerialize(Origin);
+    RoundTripNetSerialize(Direction);
+    RoundTripNetSerialize(InheritedVelocity);
+}
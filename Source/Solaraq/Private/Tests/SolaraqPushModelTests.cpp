@@ -0,0 +1,226 @@
+// SolaraqPushModelTests.cpp
+
+#include "Network/SolaraqPushModel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Components/DockingPadComponent.h"
+#include "Components/SolaraqGimbalGunComponent.h"
+#include "Components/SolaraqGimbalGunSubsystem.h"
+#include "Engine/DamageEvents.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Gameplay/Destructibles/SolaraqDestructibleObjectBase.h"
+#include "Gameplay/Pickups/SolaraqPickupBase.h"
+#include "Misc/AutomationTest.h"
+#include "Net/UnrealNetwork.h"
+#include "Pawns/SolaraqEnemyShip.h"
+
+namespace
+{
+    UWorld* CreateTestWorld()
+    {
+        UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("SolaraqPushModelTestWorld"));
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+        World->InitializeActorsForPlay(FURL());
+        World->BeginPlay();
+        return World;
+    }
+
+    void DestroyTestWorld(UWorld* World)
+    {
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    /**
+     * The object's push-based replicated properties declared in this module, exported as text by name. Engine
+     * properties (ReplicatedMovement, bHidden...) are marked by the engine, which doesn't go through the recorder.
+     */
+    TMap<FName, FString> CapturePushBasedState(UObject* Object)
+    {
+        UClass* Class = Object->GetClass();
+        Class->SetUpRuntimeReplicationData();
+
+        TArray<FLifetimeProperty> LifetimeProps;
+        Object->GetLifetimeReplicatedProps(LifetimeProps);
+
+        TMap<FName, FString> State;
+        for (const FLifetimeProperty& LifetimeProp : LifetimeProps)
+        {
+            if (!LifetimeProp.bIsPushBased || !Class->ClassReps.IsValidIndex(LifetimeProp.RepIndex))
+            {
+                continue;
+            }
+
+            const FRepRecord& Record = Class->ClassReps[LifetimeProp.RepIndex];
+            if (Record.Property->GetOutermost()->GetFName() != FName(TEXT("/Script/Solaraq")))
+            {
+                continue;
+            }
+
+            FString Value;
+            Record.Property->ExportText_InContainer(Record.Index, Value, Object, nullptr, Object, PPF_None);
+            State.FindOrAdd(Record.Property->GetFName()) += Value;
+        }
+        return State;
+    }
+
+    /** Runs Mutate on the server and fails for every push-based property of Objects it changed without marking it dirty. */
+    void TestMutator(FAutomationTestBase& Test, TArrayView<UObject* const> Objects, const TCHAR* What, TFunctionRef<void()> Mutate)
+    {
+        TArray<TMap<FName, FString>> Before;
+        for (UObject* Object : Objects)
+        {
+            Before.Add(CapturePushBasedState(Object));
+        }
+        SolaraqPushModel::BeginRecording();
+        Mutate();
+
+        int32 NumChanged = 0;
+        for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+        {
+            UObject* Object = Objects[ObjectIndex];
+            for (const TPair<FName, FString>& Entry : CapturePushBasedState(Object))
+            {
+                const FString* OldValue = Before[ObjectIndex].Find(Entry.Key);
+                if (OldValue && *OldValue == Entry.Value)
+                {
+                    continue;
+                }
+
+                ++NumChanged;
+                Test.TestTrue(FString::Printf(TEXT("%s: %s.%s changed (%s -> %s) and was marked dirty"),
+                    What, *Object->GetName(), *Entry.Key.ToString(), OldValue ? **OldValue : TEXT("?"), *Entry.Value),
+                    SolaraqPushModel::WasPropertyMarkedDirty(Object, Entry.Key));
+            }
+        }
+        SolaraqPushModel::EndRecording();
+
+        // A mutator that changes nothing checks nothing
+        Test.TestTrue(FString::Printf(TEXT("%s changed replicated state"), What), NumChanged > 0);
+    }
+
+    void TestMutator(FAutomationTestBase& Test, UObject* Object, const TCHAR* What, TFunctionRef<void()> Mutate)
+    {
+        TestMutator(Test, MakeArrayView(&Object, 1), What, Mutate);
+    }
+
+    /** Stands in for the net driver's tracker so PreReplication can run without a connection. */
+    class FTestRepChangedPropertyTracker : public IRepChangedPropertyTracker
+    {
+    public:
+        virtual void SetCustomIsActiveOverride(UObject* OwningObject, const uint16 RepIndex, const bool bIsActive) override {}
+        virtual void SetExternalData(const uint8* Src, const int32 NumBits) override {}
+    };
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolaraqShipPushModelTest, "Solaraq.Network.PushModel.Ship",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSolaraqShipPushModelTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = CreateTestWorld();
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ASolaraqShipBase* Ship = World->SpawnActor<ASolaraqEnemyShip>(SpawnParams);
+    AActor* Station = World->SpawnActor<AActor>(SpawnParams);
+    if (!TestNotNull(TEXT("Ship spawned"), Ship) || !TestNotNull(TEXT("Station spawned"), Station))
+    {
+        DestroyTestWorld(World);
+        return false;
+    }
+
+    // Ships attach to the station root when the pad has no attach point
+    USceneComponent* StationRoot = NewObject<USceneComponent>(Station);
+    Station->SetRootComponent(StationRoot);
+    StationRoot->RegisterComponent();
+    UDockingPadComponent* Pad = NewObject<UDockingPadComponent>(Station);
+
+    // Registering after the station began play begins play on the gun, which registers it with the gimbal subsystem
+    USolaraqGimbalGunComponent* Gun = NewObject<USolaraqGimbalGunComponent>(Station);
+    Gun->SetupAttachment(StationRoot);
+    Gun->RegisterComponent();
+    USolaraqGimbalGunSubsystem* Gimbals = USolaraqGimbalGunSubsystem::Get(World);
+
+    // Order matters: the health pack needs missing health, and death comes last
+    TestMutator(*this, Ship, TEXT("TakeDamage"), [Ship]() { Ship->TakeDamage(20.0f, FDamageEvent(), nullptr, nullptr); });
+    TestMutator(*this, Ship, TEXT("CollectPickup(Health_Pack)"), [Ship]() { Ship->CollectPickup(EPickupType::Health_Pack, 5); });
+    TestMutator(*this, Ship, TEXT("RestoreHealth"), [Ship]() { Ship->RestoreHealth(Ship->GetMaxHealth()); });
+    TestMutator(*this, Ship, TEXT("CollectPickup(Resource_Iron)"), [Ship]() { Ship->CollectPickup(EPickupType::Resource_Iron, 3); });
+    TestMutator(*this, Ship, TEXT("CollectPickup(Resource_Crystal)"), [Ship]() { Ship->CollectPickup(EPickupType::Resource_Crystal, 3); });
+    TestMutator(*this, Ship, TEXT("CollectPickup(Ammo_Standard)"), [Ship]() { Ship->CollectPickup(EPickupType::Ammo_Standard, 3); });
+    TestMutator(*this, Ship, TEXT("SetTurnInputForRoll"), [Ship]() { Ship->SetTurnInputForRoll(1.0f); });
+
+    // The world doesn't tick here; movement stamps, boost and regen timing read the world time, so advance it by hand
+    World->TimeSeconds = 1.0;
+    TestMutator(*this, Ship, TEXT("PreReplication"), [Ship]()
+    {
+        Ship->SetActorLocation(FVector(500.0f, 0.0f, 0.0f), false, nullptr, ETeleportType::TeleportPhysics);
+        FTestRepChangedPropertyTracker Tracker;
+        Ship->PreReplication(Tracker); // Stamps the newly gathered movement
+    });
+    TestMutator(*this, Ship, TEXT("Boost"), [Ship]()
+    {
+        Ship->Server_SetAttemptingBoost(true); // Runs locally on the server
+        Ship->Tick(0.1f); // Starts boosting and drains energy
+    });
+    TestMutator(*this, Ship, TEXT("Boost stop"), [Ship]()
+    {
+        Ship->Server_SetAttemptingBoost(false);
+        Ship->Tick(0.1f);
+    });
+    World->TimeSeconds += 10.0; // Past EnergyRegenDelay
+    TestMutator(*this, Ship, TEXT("Energy regen"), [Ship]() { Ship->Tick(0.1f); });
+
+    if (TestNotNull(TEXT("Gimbal subsystem"), Gimbals))
+    {
+        TestMutator(*this, Gun, TEXT("UpdateReplicatedYaw"), [Station, Gun, Gimbals]()
+        {
+            Gun->AimAtWorldLocation(Station->GetActorLocation() + FVector(0.0f, 1000.0f, 0.0f)); // Server-side aim
+            Gimbals->Tick(0.1f); // Refreshes ReplicatedYaw for the new target
+        });
+    }
+
+    UObject* const DockingObjects[] = { Ship, Pad };
+    TestMutator(*this, DockingObjects, TEXT("InitiateDocking"), [Ship, Pad]() { Pad->InitiateDocking(Ship); });
+    TestTrue(TEXT("Ship docked"), Ship->IsDockedTo(Pad));
+    TestMutator(*this, DockingObjects, TEXT("InitiateUndocking"), [Pad]() { Pad->InitiateUndocking(); });
+    TestTrue(TEXT("Pad available"), Pad->GetDockingStatus() == EDockingStatus::Available);
+    TestMutator(*this, Ship, TEXT("HandleDestruction"), [Ship]() { Ship->TakeDamage(Ship->GetMaxHealth() * 2.0f, FDamageEvent(), nullptr, nullptr); });
+    TestTrue(TEXT("Ship died"), Ship->IsDead());
+
+    DestroyTestWorld(World);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSolaraqDestructiblePushModelTest, "Solaraq.Network.PushModel.Destructible",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FSolaraqDestructiblePushModelTest::RunTest(const FString& Parameters)
+{
+    UWorld* World = CreateTestWorld();
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    ASolaraqDestructibleObjectBase* Destructible = World->SpawnActor<ASolaraqDestructibleObjectBase>(SpawnParams);
+    if (!TestNotNull(TEXT("Destructible spawned"), Destructible))
+    {
+        DestroyTestWorld(World);
+        return false;
+    }
+
+    TestMutator(*this, Destructible, TEXT("TakeDamage"), [Destructible]() { Destructible->TakeDamage(10.0f, FDamageEvent(), nullptr, nullptr); });
+    TestMutator(*this, Destructible, TEXT("HandleDestruction"), [Destructible]()
+    {
+        Destructible->TakeDamage(1.0e6f, FDamageEvent(), nullptr, nullptr);
+    });
+    TestTrue(TEXT("Destructible destroyed"), Destructible->IsDestroyed());
+
+    DestroyTestWorld(World);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -12,6 +12,11 @@ class UAIPerceptionComponent;
 class UAISenseConfig_Sight;
 class UAISenseConfig_AI;
 class ASolaraqEnemyShip; // Forward declare your ship base
+class ASolaraqShipBase;
+class USolaraqAIProfile;
+struct FSolaraqNavPath;
+struct FSolaraqDogfightTuning;
+struct FStreamableHandle;
 
 
 UENUM(BlueprintType)
@@ -22,6 +27,15 @@ enum class EDogfightState : uint8
 	Reposition      UMETA(DisplayName = "Reposition")        // Moving away briefly to reset angle
 };
 
+/** Slot layout used when other ships form up on this controller's ship. */
+UENUM(BlueprintType)
+enum class ESolaraqFormationShape : uint8
+{
+	Wedge   UMETA(DisplayName = "Wedge"),   // V behind the leader
+	Line    UMETA(DisplayName = "Line"),    // Abreast of the leader
+	Column  UMETA(DisplayName = "Column")   // Single file behind the leader
+};
+
 /**
  * AI Controller for Solaraq enemy ships. Uses AIPerception and C++ logic.
  */
@@ -39,6 +53,8 @@ public:
 	FGenericTeamId TeamId = FGenericTeamId(1); 
 
 	virtual FGenericTeamId GetGenericTeamId() const override;
+	/** Also refreshes the controlled ship's entry in the team registry (the controller's team wins there). */
+	virtual void SetGenericTeamId(const FGenericTeamId& NewTeamId) override;
 	virtual ETeamAttitude::Type GetTeamAttitudeTowards(const AActor& Other) const override;
 	// --- End Generic Team Interface ---
 	
@@ -62,10 +78,54 @@ public:
 		FVector& InterceptPoint // Output parameter
 	);
 
+	// --- Squad Interface (driven by USolaraqSquadSubsystem) ---
+	/** Hostile ships this controller perceives and isn't occluded from. Pooled across the squad for target assignment. */
+	const TArray<TWeakObjectPtr<ASolaraqShipBase>>& GetPerceivedHostiles() const { return PerceivedHostiles; }
+
+	/** Target and dogfight offset side picked by the squad. While set, this controller only steers and fires. */
+	void ApplySquadOrders(AActor* AssignedTarget, int32 OffsetSide);
+
+	/** Drops squad orders; the controller falls back to picking the nearest perceived hostile itself. */
+	void ClearSquadOrders();
+
+	ASolaraqEnemyShip* GetControlledEnemyShip() const { return ControlledEnemyShip; }
+
+	/** Actor currently being engaged (squad-assigned or self-picked). Used for missile locks. */
+	AActor* GetCurrentTarget() const { return CurrentTargetActor.Get(); }
+	// --- End Squad Interface ---
+
+	// --- Formation Interface ---
+	/** Makes Follower fly in the next free slot around this controller's ship. The follower stops its own target search. */
+	UFUNCTION(BlueprintCallable, Category = "Solaraq|AI|Formation")
+	void AddFormationFollower(ASolaraqAIController* Follower);
+
+	/** Leader: releases every follower. Follower: leaves its formation. Everyone goes back to full AI. */
+	UFUNCTION(BlueprintCallable, Category = "Solaraq|AI|Formation")
+	void BreakFormation();
+
+	/** True while this controller is flying a slot (and skipping its own combat logic). */
+	UFUNCTION(BlueprintPure, Category = "Solaraq|AI|Formation")
+	bool IsFollowingFormation() const { return FormationLeader.IsValid(); }
+
+	/** Long-range destination flown to (via the nav graph) whenever there is no target. Followers come along. */
+	UFUNCTION(BlueprintCallable, Category = "Solaraq|AI|Navigation")
+	void SetMoveDestination(const FVector& Destination);
+
+	UFUNCTION(BlueprintCallable, Category = "Solaraq|AI|Navigation")
+	void ClearMoveDestination() { bHasMoveDestination = false; }
+	// --- End Formation Interface ---
+
+	/** Swaps the tuning profile at runtime. Loads asynchronously; the previous profile stays active until it arrives. */
+	UFUNCTION(BlueprintCallable, Category = "Solaraq|AI")
+	void SetBehaviorProfile(TSoftObjectPtr<USolaraqAIProfile> NewProfile);
+
 protected:
     //~ Begin AController Interface
     /** Called when the controller possesses a Pawn. Sets up perception binding. */
     virtual void OnPossess(APawn* InPawn) override;
+    /** Called when the controller releases its Pawn. Leaves the squad. */
+    virtual void OnUnPossess() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     /** Called every frame. Main AI logic loop. */
     virtual void Tick(float DeltaTime) override;
     //~ End AController Interface
@@ -93,28 +153,30 @@ protected:
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Solaraq | AI State")
     FVector PredictedAimLocation;
 
-    /** Does the AI currently have sight of the target? */
+    /** Does the AI currently have sight of the target? (Perceived AND the async LoS trace isn't blocked) */
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Solaraq | AI State")
     bool bHasLineOfSight = false;
-	
-	// --- Movement Behavior Parameters ---
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Dogfight")
-	float DogfightOffsetDistance = 1500.0f; // How far to the side to aim during offset approach
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Dogfight")
-	float OffsetApproachDuration = 2.5f; // How long to thrust during offset approach before drifting
+    /** Is the target currently reported by the perception system? Combined with the LoS service into bHasLineOfSight. */
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Solaraq | AI State")
+    bool bTargetPerceived = false;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Dogfight")
-	float DriftAimAngleThreshold = 80.0f; // Max angle (degrees) between velocity and target dir before repositioning
+    /** True while the squad brain is choosing our target / offset side. */
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Solaraq | AI State")
+    bool bHasSquadOrders = false;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Dogfight")
-	float RepositionDuration = 1.5f; // How long to thrust away during reposition
+    /** Offset side assigned by the squad, used when entering OffsetApproach instead of a random pick. */
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Solaraq | AI State")
+    int32 SquadOffsetSide = 1;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Dogfight")
-	float RepositionDistance = 2000.0f; // How far away to move during reposition
+    /** Hostile ships from the last perception update that weren't blocked by obstacles. */
+    TArray<TWeakObjectPtr<ASolaraqShipBase>> PerceivedHostiles;
+	
+	// --- Movement Behavior Parameters ---
+	/** Shared dogfight/turning tuning. Loaded asynchronously on possess; the USolaraqAIProfile defaults apply until then. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq | AI Behavior | Dogfight")
+	TSoftObjectPtr<USolaraqAIProfile> BehaviorProfile;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Dogfight")
-	float EngageForwardThrustScale = 0.7f;
 	
     // --- Helper Functions ---
     /** Updates the CurrentTargetActor based on perception data. */
@@ -145,6 +207,39 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Movement")
 	float BoostTurnCompletionAngle = 30.0f; // Angle (degrees) within target direction to stop boost turn
+
+	// --- Obstacle Avoidance ---
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Avoidance")
+	float ObstacleAvoidanceWeight = 1.5f; // How strongly the obstacle field bends the steering direction (0 = ignore obstacles)
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Avoidance")
+	float ObstacleLookAheadTime = 0.75f; // Seconds ahead (along current velocity) at which the obstacle field is sampled
+
+	// --- Long-Range Navigation ---
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Navigation")
+	float NavWaypointAcceptRadius = 2000.0f; // Distance at which a route waypoint counts as reached
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Navigation")
+	float NavRepathInterval = 1.0f; // Seconds between route refreshes (cheap, paths are cached by the nav graph)
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Navigation")
+	float NavRepathDistance = 3000.0f; // Re-route immediately if the destination moved further than this
+
+	// --- Formation ---
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Formation")
+	ESolaraqFormationShape FormationShape = ESolaraqFormationShape::Wedge; // Layout used for ships following us
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Formation")
+	float FormationSpacing = 800.0f; // Distance between neighbouring slots
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Formation")
+	float FormationLeadTime = 1.0f; // Followers steer at their slot projected this far ahead along the leader's velocity
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Formation")
+	float FormationCatchUpDistance = 1500.0f; // Distance behind the slot at which a follower uses full thrust
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq | AI Behavior | Formation")
+	float FormationLeaderThrust = 0.7f; // Leader cruise throttle while it has followers, so they can catch up
 	
 private:
 	UPROPERTY(Transient) // Temporary state for boost turn
@@ -152,7 +247,6 @@ private:
 
 	// Helper to track strafe direction flipping
 	float TimeSinceLastStrafeFlip = 0.0f;
-	float StrafeFlipInterval = 3.0f; // How often to potentially flip strafe direction
 	int8 CurrentStrafeDirection = 1; // 1 for right, -1 for left relative to target
 
 	
@@ -170,6 +264,50 @@ private:
 	
 	// Gets the angle between ship's forward and direction to target
 	float GetAngleToTarget(const FVector& TargetLocation) const;
+
+	// Bends a movement target point around nearby obstacles using the obstacle field (O(1), no traces)
+	FVector ApplyObstacleAvoidance(const FVector& DesiredPoint) const;
+
+	// Slot offset (leader local space) for the N-th follower, from FormationShape/FormationSpacing
+	FVector ComputeFormationSlotOffset(int32 SlotIndex) const;
+
+	// Cheap follower tick: fly the slot, no perception/LoS/dogfight logic
+	void ExecuteFormationMovement(float DeltaTime);
+
+	// Fly to MoveDestination along the nav graph (no target)
+	void ExecuteTravelMovement(float DeltaTime);
+
+	// Re-runs target selection from the perception component's current knowledge (used after leaving a formation)
+	void RefreshTargetFromPerception();
+
+	// Formation links: followers keep a weak ref to the leader, their slot index and its precomputed offset
+	TWeakObjectPtr<ASolaraqAIController> FormationLeader;
+	int32 FormationSlotIndex = INDEX_NONE;
+	FVector FormationSlotOffset = FVector::ZeroVector;
+	TArray<TWeakObjectPtr<ASolaraqAIController>> FormationFollowers;
+
+	bool bHasMoveDestination = false;
+	FVector MoveDestination = FVector::ZeroVector;
+
+	// Next waypoint of the long-range route to Destination. False if the straight line is clear (or no route exists).
+	bool GetNavWaypoint(const FVector& Destination, float DeltaTime, FVector& OutWaypoint);
+
+	// Current long-range route (shared with other ships on the same leg) and progress along it
+	TSharedPtr<const FSolaraqNavPath> CurrentNavPath;
+	int32 NavWaypointIndex = 0;
+	FVector NavPathDestination = FVector::ZeroVector;
+	uint32 NavPathGraphVersion = 0;
+	float NavRepathTimer = 0.0f;
+
+	// Profile in use (shared with every controller using the same asset); nullptr = class defaults
+	UPROPERTY(Transient)
+	TObjectPtr<USolaraqAIProfile> ActiveProfile;
+
+	TSharedPtr<FStreamableHandle> ProfileLoadHandle;
+
+	const FSolaraqDogfightTuning& GetDogfightTuning() const;
+	void HandleProfileLoaded();
+	void ApplyProfileToShip();
 };
 
 
@@ -0,0 +1,100 @@
+// SolaraqAIProfile.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "SolaraqAIProfile.generated.h"
+
+/** Dogfight state machine parameters, in the order the state machine reads them. */
+USTRUCT(BlueprintType)
+struct SOLARAQ_API FSolaraqDogfightTuning
+{
+	GENERATED_BODY()
+
+	/** How far to the side to aim during offset approach. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float DogfightOffsetDistance = 1500.0f;
+
+	/** How long to thrust during offset approach before drifting. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float OffsetApproachDuration = 2.5f;
+
+	/** Throttle held while drifting and shooting. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float EngageForwardThrustScale = 0.7f;
+
+	/** Max angle (degrees) between velocity and target direction before repositioning. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float DriftAimAngleThreshold = 80.0f;
+
+	/** How long to thrust away during reposition. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float RepositionDuration = 1.5f;
+
+	/** How far away to move during reposition. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float RepositionDistance = 2000.0f;
+
+	/** How strongly repositioning bends toward the threat map's retreat direction (0 = straight away). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float RepositionThreatWeight = 1.0f;
+
+	/** How often to potentially flip strafe direction. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Dogfight")
+	float StrafeFlipInterval = 3.0f;
+};
+
+/** Yaw torque controller used by ASolaraqEnemyShip::TurnTowards. */
+USTRUCT(BlueprintType)
+struct SOLARAQ_API FSolaraqTurnTuning
+{
+	GENERATED_BODY()
+
+	/** Torque (deg/s^2, mass independent) applied when far from the target heading. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Turning")
+	float MaxTurnTorque = 3000.0f;
+
+	/** Heading error (degrees) below which torque starts scaling down. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Turning", meta = (ClampMin = "1.0"))
+	float SlowdownAngle = 90.0f;
+
+	/** Torque never drops below this fraction of MaxTurnTorque while turning. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Turning", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float MinTorqueFactor = 0.5f;
+
+	/** Heading error (degrees) treated as aligned: no torque, spin is damped instead. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Turning", meta = (ClampMin = "0.0"))
+	float AlignedAngle = 2.0f;
+
+	/** Yaw rate multiplier applied per update while aligned. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Turning", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float AlignedSpinDamping = 0.5f;
+
+	/** Physics-thread PD steering only: 1 = critically damped, below 1 overshoots, above 1 settles slower. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Turning", meta = (ClampMin = "0.1"))
+	float YawDampingRatio = 1.0f;
+};
+
+/**
+ * @brief Shared, read-only AI behaviour tuning.
+ *
+ * One asset is referenced by every controller/ship that uses it instead of each instance carrying its own copy.
+ * Controllers load it asynchronously (see ASolaraqAIController::SetBehaviorProfile) and fall back to this class's
+ * defaults until it arrives, so the code defaults are the "standard" profile.
+ */
+UCLASS(BlueprintType)
+class SOLARAQ_API USolaraqAIProfile : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI")
+	FSolaraqDogfightTuning Dogfight;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI")
+	FSolaraqTurnTuning Turning;
+
+	/** Profile to read when none is assigned or it hasn't loaded yet. */
+	static const USolaraqAIProfile& GetDefaultProfile() { return *GetDefault<USolaraqAIProfile>(); }
+};
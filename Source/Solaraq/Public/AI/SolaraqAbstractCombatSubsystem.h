@@ -0,0 +1,114 @@
+// SolaraqAbstractCombatSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GenericTeamAgentInterface.h"
+#include "SolaraqAbstractCombatSubsystem.generated.h"
+
+class ASolaraqEnemyShip;
+class ASolaraqAIController;
+
+/**
+ * @brief Resolves AI-vs-AI fights no player can see with a damage-rate model instead of real actors.
+ *
+ * Every EvaluateInterval the subsystem clusters AI ships into engagements (ships within EngagementRadius of each
+ * other, at least two mutually hostile teams). An engagement with no player within CollapseDistance is collapsed:
+ * every ship is stored as a small record (class, team, health, DPS, offset from the engagement centre) and the
+ * actors are destroyed.
+ *
+ * Records are resolved every ResolveInterval: each ship focuses its DPS (scaled by AbstractHitRate) on the weakest
+ * hostile in the record, simultaneously for all ships. Once a player comes within RehydrateDistance the surviving
+ * ships are spawned back at their offsets with their remaining health. Collapse uses a larger distance than
+ * rehydration so fights don't flicker between the two modes. Server only.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqAbstractCombatSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqAbstractCombatSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Turns abstract combat on/off at runtime (e.g. the benchmark wants real fights). Disabling rehydrates every record. */
+	void SetEnabled(bool bInEnabled);
+
+	/** Number of collapsed engagements / ships currently simulated abstractly. */
+	int32 GetNumRecords() const { return Records.Num(); }
+	int32 GetNumAbstractShips() const;
+
+protected:
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|AbstractCombat")
+	bool bEnabled = true;
+
+	/** Seconds between engagement detection / player proximity checks. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|AbstractCombat", meta = (ClampMin = "0.1"))
+	float EvaluateInterval = 1.0f;
+
+	/** Seconds between damage-model steps. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|AbstractCombat", meta = (ClampMin = "0.05"))
+	float ResolveInterval = 0.5f;
+
+	/** Ships closer than this to each other belong to the same engagement. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|AbstractCombat", meta = (ClampMin = "100.0"))
+	float EngagementRadius = 8000.0f;
+
+	/** An engagement collapses when no player is within this distance of its bounds. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|AbstractCombat", meta = (ClampMin = "0.0"))
+	float CollapseDistance = 30000.0f;
+
+	/** A record is turned back into actors when a player gets within this distance of its bounds. Keep below CollapseDistance. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|AbstractCombat", meta = (ClampMin = "0.0"))
+	float RehydrateDistance = 24000.0f;
+
+	/** Fraction of theoretical DPS that lands. Real dogfights miss a lot; tune against benchmark runs. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|AbstractCombat", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float AbstractHitRate = 0.3f;
+
+private:
+	struct FAbstractShip
+	{
+		TSubclassOf<ASolaraqEnemyShip> ShipClass;
+		TSubclassOf<ASolaraqAIController> ControllerClass;
+		FGenericTeamId TeamId;
+		float Health = 0.0f;
+		float DamagePerSecond = 0.0f;
+		FVector Offset = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+	};
+
+	struct FCombatRecord
+	{
+		FVector Center = FVector::ZeroVector;
+		float Radius = 0.0f;
+		TArray<FAbstractShip> Ships;
+		bool bResolved = false;
+	};
+
+	void GatherPlayerLocations(TArray<FVector>& OutLocations) const;
+	bool IsAnyPlayerNear(const TArray<FVector>& PlayerLocations, const FVector& Center, float Distance) const;
+
+	void CollapseEngagements(const TArray<FVector>& PlayerLocations);
+	void CollapseShips(const TArray<ASolaraqEnemyShip*>& Ships);
+	void ResolveRecord(FCombatRecord& Record, float DeltaTime);
+	void RehydrateRecord(const FCombatRecord& Record);
+
+	/** True if any two teams in the list are hostile to each other. */
+	bool HasHostilePair(const TArray<FGenericTeamId, TInlineAllocator<4>>& Teams) const;
+
+	TArray<FCombatRecord> Records;
+	float TimeUntilEvaluate = 0.0f;
+	float TimeUntilResolve = 0.0f;
+};
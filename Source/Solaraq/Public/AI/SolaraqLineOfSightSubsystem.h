@@ -0,0 +1,131 @@
+// SolaraqLineOfSightSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "UObject/ObjectKey.h"
+#include "SolaraqLineOfSightSubsystem.generated.h"
+
+class AActor;
+
+/** Result of a cached line-of-sight / shot-lane query. */
+UENUM(BlueprintType)
+enum class ESolaraqLineOfSight : uint8
+{
+	Unknown UMETA(DisplayName = "Unknown"), // Never traced yet, result arrives next frame
+	Clear   UMETA(DisplayName = "Clear"),
+	Blocked UMETA(DisplayName = "Blocked")
+};
+
+/** What a query is used for. Kept in the cache key so LoS and shot lane of the same pair don't overwrite each other. */
+UENUM()
+enum class ESolaraqLineOfSightQuery : uint8
+{
+	Sight,      // Shooter centre -> target centre, on the Visibility channel
+	ShotLane    // Muzzle -> predicted aim point, swept with the projectile radius on the Projectile channel
+};
+
+/**
+ * @brief Batched, asynchronous line-of-sight service for AI.
+ *
+ * AI controllers ask for a (shooter, target, kind) pair every tick; the answer comes from a short-lived cache.
+ * Stale or missing entries are queued and traced asynchronously on the next subsystem tick, limited to
+ * MaxTracesPerFrame, so results arrive the frame after they are requested and the trace cost is bounded no
+ * matter how many ships are fighting. Server only.
+ *
+ * Traces are by channel, not object type, so trigger volumes that ignore the channel (celestial influence spheres,
+ * pickup spheres) don't block sight.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqLineOfSightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqLineOfSightSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/**
+	 * Returns the cached visibility between Shooter and Target and schedules a refresh when the entry is older than CacheLifetime.
+	 * From/To are the endpoints to use for the next trace. Shooter and Target are ignored by the trace.
+	 */
+	ESolaraqLineOfSight QueryLineOfSight(const AActor* Shooter, const AActor* Target, const FVector& From, const FVector& To, ESolaraqLineOfSightQuery Kind = ESolaraqLineOfSightQuery::Sight);
+
+protected:
+	/** Hard cap on async traces issued per frame. Remaining requests wait for the next frame. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|LineOfSight", meta = (ClampMin = "1"))
+	int32 MaxTracesPerFrame = 64;
+
+	/** How long (seconds) a result is served from the cache before it is re-traced. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|LineOfSight", meta = (ClampMin = "0.0"))
+	float CacheLifetime = 0.25f;
+
+	/** Radius of the sweep used for shot lanes (roughly the projectile radius). 0 = plain line trace. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|LineOfSight", meta = (ClampMin = "0.0"))
+	float ShotLaneRadius = 15.0f;
+
+	/** A trace whose result hasn't arrived after this long (seconds) is dropped and re-queued. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|LineOfSight", meta = (ClampMin = "0.1"))
+	float InFlightTimeout = 1.0f;
+
+private:
+	struct FQueryKey
+	{
+		TObjectKey<AActor> Shooter;
+		TObjectKey<AActor> Target;
+		ESolaraqLineOfSightQuery Kind = ESolaraqLineOfSightQuery::Sight;
+
+		bool operator==(const FQueryKey& Other) const
+		{
+			return Shooter == Other.Shooter && Target == Other.Target && Kind == Other.Kind;
+		}
+
+		friend uint32 GetTypeHash(const FQueryKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Shooter), GetTypeHash(Key.Target)), static_cast<uint32>(Key.Kind));
+		}
+	};
+
+	struct FQueryEntry
+	{
+		FVector From = FVector::ZeroVector;
+		FVector To = FVector::ZeroVector;
+		double ResultTime = -1.0;     // World time of the last completed trace
+		double LastRequestTime = 0.0; // World time of the last QueryLineOfSight call (for pruning)
+		double IssueTime = 0.0;       // World time the in-flight trace was issued
+		uint32 RequestId = 0;         // Id of the in-flight trace
+		ESolaraqLineOfSight Result = ESolaraqLineOfSight::Unknown;
+		bool bQueued = false;
+		bool bInFlight = false;
+	};
+
+	void OnTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceData);
+	void PruneStaleEntries(double Now);
+
+	/** Drops in-flight traces older than InFlightTimeout (lost handle, world teardown) so their pairs can be traced again. */
+	void ExpireLostTraces(double Now);
+
+	TMap<FQueryKey, FQueryEntry> Entries;
+
+	/** Keys waiting for a trace, oldest first. */
+	TArray<FQueryKey> PendingQueue;
+
+	/** Async traces in flight, keyed by the id we stash in FTraceDatum::UserData. */
+	TMap<uint32, FQueryKey> InFlight;
+	uint32 NextRequestId = 1;
+
+	FTraceDelegate TraceDelegate;
+	double LastPruneTime = 0.0;
+};
@@ -0,0 +1,175 @@
+// SolaraqNavGraphSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqNavGraphSubsystem.generated.h"
+
+/** A route through the nav graph. Shared (read-only) between every ship flying the same leg. */
+struct FSolaraqNavPath
+{
+	/** Graph waypoints in flight order. Empty = the straight line is clear, fly directly. */
+	TArray<FVector> Waypoints;
+};
+
+/**
+ * @brief Sparse long-range waypoint graph for routing AI across a system.
+ *
+ * Built once when the world begins play from:
+ * - ACelestialBodyBase: a ring of nodes just outside the influence sphere; the sphere itself blocks edges.
+ * - AAsteroidFieldGenerator: nodes along both sides of a belt spline (or a ring around a filled field);
+ *   crossing a field is allowed but costs BeltCrossingCostMultiplier times the distance.
+ * - Actors with docking pads: one node each, so stations are reachable destinations.
+ *
+ * FindPath snaps both ends to the nearest visible node, runs A* and caches the result per (start node, goal node)
+ * pair, so ships heading to the same place from the same area share a single path object.
+ * Sources are polled every SourcePollInterval; when one moves, only its nodes and the edges near its old/new
+ * footprint are re-evaluated and the path cache is flushed. Server only.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqNavGraphSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqNavGraphSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/**
+	 * Route from From to To around celestial influence spheres.
+	 * The path ends at the graph node nearest To; fly straight to To after the last waypoint.
+	 * Returns nullptr if no route exists (e.g. no node is visible from one of the ends).
+	 */
+	TSharedPtr<const FSolaraqNavPath> FindPath(const FVector& From, const FVector& To);
+
+	/** True if the straight segment does not pass through any blocking influence sphere. */
+	bool IsSegmentClear(const FVector& From, const FVector& To) const;
+
+	/** Incremented whenever nodes or edges change. Holders of a path can compare this to know when to re-query. */
+	uint32 GetGraphVersion() const { return GraphVersion; }
+
+	int32 GetNumNodes() const { return NodeLocations.Num(); }
+
+protected:
+	/** Number of nodes placed around every celestial body. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "3"))
+	int32 CelestialRingNodes = 8;
+
+	/** Ring radius as a multiple of the influence radius. Must stay above 1/cos(180/N) so ring edges clear the sphere. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "1.0"))
+	float CelestialRingScale = 1.15f;
+
+	/** Spacing of nodes along asteroid belt splines. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "500.0"))
+	float BeltNodeSpacing = 5000.0f;
+
+	/** Distance kept from the edge of an asteroid belt / field. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "0.0"))
+	float BeltClearance = 1500.0f;
+
+	/** Cost multiplier for edges that pass through an asteroid field. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "1.0"))
+	float BeltCrossingCostMultiplier = 4.0f;
+
+	/** Nodes further apart than this are never linked directly. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "1000.0"))
+	float MaxLinkDistance = 60000.0f;
+
+	/** Seconds between checks whether a source (planet, field, station) has moved. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "0.1"))
+	float SourcePollInterval = 1.0f;
+
+	/** A source has to move further than this before the graph is updated. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "0.0"))
+	float SourceMoveTolerance = 500.0f;
+
+	/** Cache is flushed once it holds more paths than this. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Navigation", meta = (ClampMin = "1"))
+	int32 MaxCachedPaths = 256;
+
+private:
+	enum class EObstacleKind : uint8
+	{
+		Blocking, // Celestial influence sphere, edges may not cross
+		Costly    // Asteroid field, edges may cross at a higher cost
+	};
+
+	/** A capsule on the XY plane (A == B for a circle). */
+	struct FObstacle
+	{
+		FVector2D A;
+		FVector2D B;
+		float Radius = 0.0f;
+		EObstacleKind Kind = EObstacleKind::Blocking;
+	};
+
+	/** An actor that contributed nodes/obstacles. Its nodes and obstacles are stored contiguously. */
+	struct FSource
+	{
+		TWeakObjectPtr<const AActor> Actor;
+		FVector LastLocation = FVector::ZeroVector;
+		int32 FirstNode = 0;
+		int32 NumNodes = 0;
+		int32 FirstObstacle = 0;
+		int32 NumObstacles = 0;
+	};
+
+	/** A node pair within MaxLinkDistance. Kept so edges can be re-tested without an O(N^2) rescan. */
+	struct FCandidateEdge
+	{
+		int32 NodeA = INDEX_NONE;
+		int32 NodeB = INDEX_NONE;
+		float Cost = 0.0f;
+		bool bBlocked = false;
+	};
+
+	struct FLink
+	{
+		int32 Node;
+		float Cost;
+	};
+
+	void BuildGraph(UWorld& World);
+	void AddCelestialSources(UWorld& World);
+	void AddAsteroidFieldSources(UWorld& World);
+	void AddDockingSources(UWorld& World);
+
+	void BuildAllCandidates();
+	void EvaluateCandidate(FCandidateEdge& Candidate) const;
+	void RebuildAdjacency();
+	void HandleSourceMoved(int32 SourceIndex, const FVector& Delta);
+
+	int32 FindNearestVisibleNode(const FVector& Location) const;
+	TSharedPtr<const FSolaraqNavPath> RunAStar(int32 StartNode, int32 GoalNode) const;
+
+	/** Whether the segment crosses an obstacle of the given kind (obstacles containing either end are ignored). */
+	bool SegmentHitsObstacle(const FVector2D& From, const FVector2D& To, EObstacleKind Kind) const;
+
+	// --- Graph ---
+	TArray<FVector> NodeLocations;
+	TArray<TArray<FLink, TInlineAllocator<8>>> Adjacency;
+	TArray<FObstacle> Obstacles;
+	TArray<FSource> Sources;
+	TArray<FCandidateEdge> Candidates;
+
+	// --- Path cache (key = start node << 32 | goal node) ---
+	TMap<uint64, TSharedPtr<const FSolaraqNavPath>> PathCache;
+
+	/** Shared empty path returned whenever the straight line is clear. */
+	TSharedPtr<const FSolaraqNavPath> DirectPath;
+
+	uint32 GraphVersion = 0;
+	float TimeUntilSourcePoll = 0.0f;
+};
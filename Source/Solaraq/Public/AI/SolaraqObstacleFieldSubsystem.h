@@ -0,0 +1,132 @@
+// SolaraqObstacleFieldSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqObstacleFieldSubsystem.generated.h"
+
+/**
+ * @brief Coarse 2D occupancy / distance field over the play plane, used by AI steering.
+ *
+ * Static-ish obstacles (asteroid instances, celestial body meshes, destructibles) register as circles.
+ * The field stores, per cell, the distance to the nearest obstacle surface and the direction pointing away from it.
+ * AI samples it in O(1) instead of issuing line traces.
+ *
+ * Updates are incremental: adding/moving/removing an obstacle only re-stamps the cells its influence touches,
+ * processed on the next subsystem tick. A full rebuild only happens when an obstacle lands outside the current bounds.
+ * Obstacles are bucketed by coarse cell blocks, so re-stamping a region only visits the obstacles near it.
+ * Server only; clients never register obstacles.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqObstacleFieldSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqObstacleFieldSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	// --- Obstacle Registration ---
+
+	/** Registers a circular obstacle on the XY plane. Returns a handle (>= 0) for later updates. */
+	int32 AddObstacle(const FVector& Location, float Radius);
+
+	/** Moves/resizes an existing obstacle. Changes under a quarter cell are ignored, so owners can call this on every move. */
+	void UpdateObstacle(int32 ObstacleHandle, const FVector& Location, float Radius);
+
+	/** Removes an obstacle and resets the handle to INDEX_NONE. */
+	void RemoveObstacle(int32& ObstacleHandle);
+
+	// --- Queries (O(1)) ---
+
+	/** Distance from Location to the nearest obstacle surface. Returns InfluenceDistance when nothing is near (or outside the field). */
+	float SampleDistance(const FVector& Location) const;
+
+	/**
+	 * Avoidance vector at Location: points away from the nearest obstacle, length in [0..1]
+	 * (0 at InfluenceDistance from the surface, 1 at/inside the surface). Z is always 0.
+	 */
+	FVector SampleAvoidance(const FVector& Location) const;
+
+	/** Size of a field cell in world units (may be larger than CellSize for very large maps). */
+	float GetCellSize() const { return GridCellSize; }
+
+protected:
+	/** Desired cell size in world units. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Obstacles", meta = (ClampMin = "50.0"))
+	float CellSize = 500.0f;
+
+	/** Obstacles are "felt" up to this far from their surface. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Obstacles", meta = (ClampMin = "0.0"))
+	float InfluenceDistance = 2500.0f;
+
+	/** Upper bound on cells per axis. The effective cell size grows to respect it. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Obstacles", meta = (ClampMin = "16"))
+	int32 MaxCellsPerAxis = 512;
+
+private:
+	struct FObstacle
+	{
+		FVector2D Center = FVector2D::ZeroVector;
+		float Radius = 0.0f;
+	};
+
+	/** Cell rectangle touched by an obstacle's influence, clamped to the grid. Returns false if fully outside. */
+	bool GetInfluenceCellRect(const FObstacle& Obstacle, FIntRect& OutRect) const;
+
+	/** True if the obstacle's influence fits inside the current grid bounds. */
+	bool FitsInGrid(const FObstacle& Obstacle) const;
+
+	/**
+	 * Marks an obstacle's influence area for re-stamping, or schedules a full rebuild if it doesn't fit.
+	 * A removed obstacle never needs bigger bounds: only the part inside the grid is re-stamped.
+	 */
+	void MarkDirty(const FObstacle& Obstacle, bool bRemoved = false);
+
+	/** Adds/removes the handle in every bucket the obstacle's influence touches. */
+	void BucketObstacle(int32 ObstacleHandle, const FObstacle& Obstacle);
+	void UnbucketObstacle(int32 ObstacleHandle, const FObstacle& Obstacle);
+	FIntRect GetBucketRect(const FIntRect& CellRect) const;
+
+	void RebuildAll();
+	void RebuildRegion(const FIntRect& CellRect);
+	void StampObstacle(const FObstacle& Obstacle, const FIntRect& ClipRect);
+
+	FORCEINLINE int32 CellIndex(int32 X, int32 Y) const { return Y * GridSize.X + X; }
+	int32 CellIndexAt(const FVector& Location) const;
+
+	TSparseArray<FObstacle> Obstacles;
+
+	/** Distance to nearest surface, per cell (row-major). */
+	TArray<float> CellDistances;
+	/** Unit direction away from the nearest obstacle, per cell. */
+	TArray<FVector2f> CellAwayDirections;
+
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+	FIntPoint GridSize = FIntPoint::ZeroValue;
+	float GridCellSize = 500.0f;
+
+	/** Side of a bucket, in cells. */
+	static constexpr int32 BucketCells = 8;
+
+	/** Obstacle handles per bucket (cell / BucketCells), rebuilt with the grid. */
+	TMap<FIntPoint, TArray<int32>> Buckets;
+
+	/** Reused by RebuildRegion. */
+	TArray<int32> CandidateScratch;
+
+	/** Cell regions waiting to be re-stamped on the next tick. */
+	TArray<FIntRect> PendingRegions;
+	bool bNeedsFullRebuild = false;
+};
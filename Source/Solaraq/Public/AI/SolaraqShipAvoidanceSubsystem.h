@@ -0,0 +1,105 @@
+// SolaraqShipAvoidanceSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqShipAvoidanceSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/** Per-query tuning, filled from the asking ship class (see ASolaraqEnemyShip avoidance properties). */
+struct FSolaraqAvoidanceParams
+{
+	/** Seconds ahead in which collisions with neighbours are avoided. Larger = earlier, smoother swerves. */
+	float TimeHorizon = 2.0f;
+
+	/** Only neighbours within this distance are considered. */
+	float NeighborRadius = 3000.0f;
+
+	/** Closest N neighbours taken into account. */
+	int32 MaxNeighbors = 8;
+
+	/** Speed limit for the resulting velocity. */
+	float MaxSpeed = 2000.0f;
+};
+
+/**
+ * @brief Reciprocal (ORCA-style) collision avoidance between AI ships on the XY play plane.
+ *
+ * Ships register an agent (physics body + radius). Once per frame the subsystem snapshots every agent's position
+ * and velocity and sorts them into a uniform grid, so a neighbour query only touches the surrounding 3x3 cells and
+ * the total cost stays near-linear in ship count.
+ *
+ * ComputeAvoidanceVelocity builds one ORCA half-plane per neighbour (each side takes half of the responsibility)
+ * and projects the desired velocity onto them. We use a few rounds of sequential projection rather than the full
+ * incremental linear program; with the handful of neighbours a dogfight produces this is visually identical and
+ * much cheaper. Server only.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqShipAvoidanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqShipAvoidanceSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Registers a body that takes part in avoidance. Returns a handle (INDEX_NONE on failure). */
+	int32 RegisterAgent(UPrimitiveComponent* Body, float Radius);
+
+	/** Removes an agent and resets the handle to INDEX_NONE. */
+	void UnregisterAgent(int32& Handle);
+
+	/**
+	 * Returns the velocity closest to DesiredVelocity that avoids every neighbour for Params.TimeHorizon seconds,
+	 * assuming they do their half of the work. Z is passed through unchanged.
+	 */
+	FVector ComputeAvoidanceVelocity(int32 Handle, const FVector& DesiredVelocity, const FSolaraqAvoidanceParams& Params) const;
+
+protected:
+	/** Edge length of a neighbour grid cell. Should be around the typical NeighborRadius. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Avoidance", meta = (ClampMin = "100.0"))
+	float CellSize = 3000.0f;
+
+	/** Projection rounds over the half-planes. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Avoidance", meta = (ClampMin = "1"))
+	int32 SolverIterations = 3;
+
+private:
+	/** An ORCA half-plane: permitted velocities lie to the left of Direction through Point. */
+	struct FOrcaLine
+	{
+		FVector2D Point;
+		FVector2D Direction;
+	};
+
+	void RebuildGrid();
+	FIntPoint GetCell(const FVector2D& Location) const;
+
+	// --- Agent storage (SoA, indexed by handle) ---
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Bodies;
+	TArray<FVector2D> Positions;
+	TArray<FVector2D> Velocities;
+	TArray<float> Radii;
+	TArray<bool> bActive;
+	TArray<int32> FreeHandles;
+
+	// --- Neighbour grid, rebuilt every frame ---
+	/** Active handles sorted by cell. */
+	TArray<int32> SortedAgents;
+	/** Cell -> (first index in SortedAgents, count). */
+	TMap<FIntPoint, FIntPoint> CellRanges;
+
+	float LastDeltaTime = 1.0f / 30.0f;
+};
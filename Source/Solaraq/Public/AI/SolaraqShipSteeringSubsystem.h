@@ -0,0 +1,102 @@
+// SolaraqShipSteeringSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqShipSteeringSubsystem.generated.h"
+
+class UPrimitiveComponent;
+class FSolaraqSteeringCallback;
+struct FSolaraqSteeringInput;
+
+namespace Chaos
+{
+	class FSingleParticlePhysicsProxy;
+}
+
+/** Yaw PD gains for a steering body. Accelerations are mass independent (like AddTorque with bAccelChange). */
+struct FSolaraqYawGains
+{
+	/** deg/s^2 of angular acceleration per degree of heading error. */
+	float Stiffness = 33.3f;
+
+	/** deg/s^2 of angular acceleration per deg/s of yaw rate (opposes spin). */
+	float Damping = 11.5f;
+
+	/** Clamp for the commanded angular acceleration (deg/s^2). */
+	float MaxAcceleration = 3000.0f;
+};
+
+/** What a ship wants the physics thread to do until told otherwise (or CommandTimeout expires). */
+struct FSolaraqSteeringCommand
+{
+	Chaos::FSingleParticlePhysicsProxy* Proxy = nullptr;
+	FSolaraqYawGains Gains;
+	float DesiredYaw = 0.0f;
+	float ThrustForce = 0.0f; // Along the body's forward axis, mass aware like AddForce
+	bool bSteerYaw = false;
+
+	// Bumped on every change so the physics thread can age out stale commands. Separate per channel, so thrust
+	// refreshed every tick doesn't keep an old yaw alive after the AI stops turning.
+	uint32 YawSequence = 0;
+	uint32 ThrustSequence = 0;
+};
+
+/**
+ * @brief Runs AI ship steering on the physics thread.
+ *
+ * Ships submit a desired yaw and a thrust force whenever the AI thinks; an async physics callback then applies a PD
+ * yaw controller and the thrust every physics step (and substep) against the body's current physics-thread state.
+ * That avoids the game thread reacting to last frame's rotation, so turning doesn't oscillate and the AI can run at
+ * a lower rate than physics. Yaw and thrust each persist until replaced, or until CommandTimeout elapses without an
+ * update to that channel.
+ *
+ * Every producer input carries the full command table, so inputs merged or skipped by an async solver lose nothing.
+ * Server only.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqShipSteeringSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqShipSteeringSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	/** Registers a simulating body for physics-thread steering. Returns a handle (INDEX_NONE on failure). */
+	int32 RegisterBody(UPrimitiveComponent* Body);
+
+	/** Stops steering the body and resets the handle to INDEX_NONE. */
+	void UnregisterBody(int32& Handle);
+
+	/** Turns toward DesiredYaw (degrees) using Gains. */
+	void SetDesiredYaw(int32 Handle, float DesiredYaw, const FSolaraqYawGains& Gains);
+
+	/** Constant forward thrust (Newtons, 0 = coast). */
+	void SetThrust(int32 Handle, float ThrustForce);
+
+	/** Drops yaw and thrust commands (e.g. the ship died). */
+	void ClearCommand(int32 Handle);
+
+protected:
+	/** Physics-thread seconds after which a command that wasn't refreshed is ignored, so a stalled AI can't spin forever. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Steering", meta = (ClampMin = "0.0"))
+	float CommandTimeout = 0.5f;
+
+private:
+	/** This frame's physics input, seeded with the full command table on first use. */
+	FSolaraqSteeringInput* GetFrameInput();
+
+	/** Mirrors one command into this frame's physics input. */
+	void WriteCommand(int32 Handle);
+
+	TSparseArray<FSolaraqSteeringCommand> Commands;
+	FSolaraqSteeringCallback* Callback = nullptr;
+};
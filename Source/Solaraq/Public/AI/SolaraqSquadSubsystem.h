@@ -0,0 +1,100 @@
+// SolaraqSquadSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GenericTeamAgentInterface.h"
+#include "SolaraqSquadSubsystem.generated.h"
+
+class ASolaraqAIController;
+class ASolaraqShipBase;
+
+/**
+ * @brief Squad-level AI brain.
+ *
+ * Every SquadUpdateInterval seconds:
+ * 1. Groups registered AI controllers of the same team into squads by proximity (greedy, capped at MaxSquadSize).
+ * 2. Pools the hostile ships perceived by all members of a squad.
+ * 3. Runs a greedy assignment (cost = distance / threat, with a per-target attacker cap) so the squad spreads
+ *    over its targets instead of dogpiling the nearest one.
+ * 4. Pushes the target and an alternating dogfight offset side to every member.
+ *
+ * The per-ship controller then only handles steering/firing. Members without candidates get their orders cleared
+ * and fall back to their own nearest-target logic. Server only.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqSquadSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqSquadSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Called by AI controllers when they possess a ship. */
+	void RegisterMember(ASolaraqAIController* Controller);
+
+	/** Called by AI controllers when they lose their ship or are destroyed. */
+	void UnregisterMember(ASolaraqAIController* Controller);
+
+	/** Number of squads formed in the last update (debug/benchmark). */
+	int32 GetNumSquads() const { return Squads.Num(); }
+
+	/** Shared with solo AI target selection, so squads and lone ships weigh danger the same way. */
+	float GetTargetAreaDangerWeight() const { return TargetAreaDangerWeight; }
+
+protected:
+	/** Seconds between squad re-forming / re-assignment passes. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Squad", meta = (ClampMin = "0.05"))
+	float SquadUpdateInterval = 0.5f;
+
+	/** Ships within this distance of a squad's seed ship join that squad. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Squad", meta = (ClampMin = "0.0"))
+	float SquadRadius = 6000.0f;
+
+	/** Maximum members per squad. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Squad", meta = (ClampMin = "1"))
+	int32 MaxSquadSize = 6;
+
+	/** Soft cap on squad members attacking the same target (raised automatically if the squad outnumbers its targets). */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Squad", meta = (ClampMin = "1"))
+	int32 MaxAttackersPerTarget = 2;
+
+	/** Threat bonus for player controlled targets (higher threat = preferred). */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Squad", meta = (ClampMin = "0.0"))
+	float PlayerThreatBonus = 1.0f;
+
+	/** Threat bonus scaled by missing health, so wounded targets get finished off. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Squad", meta = (ClampMin = "0.0"))
+	float WoundedThreatBonus = 0.5f;
+
+	/** Cost multiplier per unit of threat-map danger around a target, so squads avoid diving into enemy-held space. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Squad", meta = (ClampMin = "0.0"))
+	float TargetAreaDangerWeight = 0.02f;
+
+private:
+	struct FSquad
+	{
+		TArray<ASolaraqAIController*, TInlineAllocator<8>> Members;
+		FGenericTeamId TeamId;
+	};
+
+	void FormSquads();
+	void AssignTargets(const FSquad& Squad);
+	float GetThreat(const ASolaraqShipBase* Target) const;
+
+	TArray<TWeakObjectPtr<ASolaraqAIController>> RegisteredMembers;
+	TArray<FSquad> Squads;
+	float TimeUntilUpdate = 0.0f;
+};
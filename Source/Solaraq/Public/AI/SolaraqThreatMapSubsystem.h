@@ -0,0 +1,103 @@
+// SolaraqThreatMapSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GenericTeamAgentInterface.h"
+#include "SolaraqThreatMapSubsystem.generated.h"
+
+/**
+ * @brief Coarse influence/threat map over the XY play plane.
+ *
+ * Every cell stores one influence value per team (weapon DPS, falling off linearly to zero at weapon range) plus a
+ * static hazard value stamped around celestial bodies. Sources are re-stamped every UpdateInterval, but only when
+ * they changed cell, team or strength, so the per-update cost scales with the number of ships that actually moved.
+ *
+ * GetThreat(Team, Location) sums the layers of every team hostile to Team plus the hazard, an O(1) lookup that many
+ * AI can share instead of each scanning all ships. GetRetreatDirection follows the negative threat gradient.
+ * Server only.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqThreatMapSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqThreatMapSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Adds an actor that projects threat (its team is resolved through USolaraqTeamSubsystem). Returns a handle. */
+	int32 RegisterSource(const AActor* Source, float Range, float Strength);
+
+	/** Removes the source's stamp and resets the handle to INDEX_NONE. */
+	void UnregisterSource(int32& Handle);
+
+	/** Threat to ForTeam at Location: hostile influence + environmental hazard (roughly "incoming DPS"). */
+	float GetThreat(FGenericTeamId ForTeam, const FVector& Location) const;
+
+	/** Unit XY direction of decreasing threat at Location (zero if the map is flat there). */
+	FVector GetRetreatDirection(FGenericTeamId ForTeam, const FVector& Location) const;
+
+protected:
+	/** Edge length of a map cell. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|ThreatMap", meta = (ClampMin = "100.0"))
+	float CellSize = 2000.0f;
+
+	/** Seconds between source re-stamping passes. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|ThreatMap", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.25f;
+
+	/** Hazard value at the centre of a celestial body's influence sphere (same units as weapon DPS). */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|ThreatMap", meta = (ClampMin = "0.0"))
+	float CelestialHazardStrength = 40.0f;
+
+	/** Range used for sources that don't report one. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|ThreatMap", meta = (ClampMin = "0.0"))
+	float DefaultSourceRange = 5000.0f;
+
+private:
+	/** Team IDs at or above this don't get an influence layer (they still read threat from others). */
+	static constexpr int32 MaxTeamLayers = 8;
+
+	struct FCell
+	{
+		float TeamInfluence[MaxTeamLayers] = {};
+		float Hazard = 0.0f;
+	};
+
+	struct FSource
+	{
+		TWeakObjectPtr<const AActor> Actor;
+		float Range = 0.0f;
+		float Strength = 0.0f;
+
+		// What is currently stamped into the map (needed to remove it exactly)
+		bool bStamped = false;
+		FIntPoint StampedCell = FIntPoint::ZeroValue;
+		int32 StampedLayer = 0;
+		float StampedStrength = 0.0f;
+	};
+
+	FIntPoint GetCell(const FVector& Location) const;
+	float GetCellThreat(FGenericTeamId ForTeam, const FIntPoint& Cell) const;
+
+	/** Adds Sign * Strength with linear falloff over Range around Center to a layer (INDEX_NONE = hazard). */
+	void Stamp(const FIntPoint& Center, float Range, float Strength, int32 Layer, float Sign);
+	void Unstamp(FSource& Source);
+
+	TMap<FIntPoint, FCell> Cells;
+	TSparseArray<FSource> Sources;
+	float TimeUntilUpdate = 0.0f;
+};
@@ -0,0 +1,100 @@
+// SolaraqTurretTargetingSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GenericTeamAgentInterface.h"
+#include "SolaraqTurretTargetingSubsystem.generated.h"
+
+class USolaraqGimbalGunComponent;
+class ASolaraqShipBase;
+
+/**
+ * @brief Aims and fires gimbal guns that have bAutonomousTargeting set (station / destructible turrets).
+ *
+ * Cost is bounded no matter how many turrets exist:
+ * - Candidate ships are snapshotted into one uniform grid every SnapshotInterval and shared by all turrets.
+ * - Turrets are serviced round-robin, at most MaxTurretUpdatesPerTick per frame. Each update aims (leading the
+ *   target with the AI intercept solver) and possibly fires; a new target is only searched every
+ *   ReevaluateInterval (jittered, so turrets don't re-target in lockstep).
+ * - Shots come out of a world-wide budget of MaxShotsPerSecond.
+ *
+ * Targets must be hostile, in range, inside the gun's yaw constraint arc and not occluded (line-of-sight service).
+ * Server only.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqTurretTargetingSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqTurretTargetingSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	void RegisterTurret(USolaraqGimbalGunComponent* Gun);
+	void UnregisterTurret(USolaraqGimbalGunComponent* Gun);
+
+	int32 GetNumTurrets() const { return Turrets.Num(); }
+
+protected:
+	/** Seconds between candidate (ship) snapshots. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Turrets", meta = (ClampMin = "0.0"))
+	float SnapshotInterval = 0.2f;
+
+	/** Edge length of a snapshot grid cell. Around the typical turret range. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Turrets", meta = (ClampMin = "100.0"))
+	float CellSize = 5000.0f;
+
+	/** Turrets aimed / fired per frame. Each turret is revisited every NumTurrets / this frames. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Turrets", meta = (ClampMin = "1"))
+	int32 MaxTurretUpdatesPerTick = 32;
+
+	/** Average seconds between target searches per turret. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Turrets", meta = (ClampMin = "0.0"))
+	float ReevaluateInterval = 1.0f;
+
+	/** World-wide autonomous turret shot budget. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|AI|Turrets", meta = (ClampMin = "0.0"))
+	float MaxShotsPerSecond = 30.0f;
+
+private:
+	struct FTurret
+	{
+		USolaraqGimbalGunComponent* Gun = nullptr;
+		TWeakObjectPtr<ASolaraqShipBase> Target;
+		double NextReevaluateTime = 0.0;
+	};
+
+	/** Snapshot entry. The ship may die or be destroyed before the next rebuild, hence the weak pointer. */
+	struct FCandidate
+	{
+		TWeakObjectPtr<ASolaraqShipBase> Ship;
+		FVector Location = FVector::ZeroVector;
+		FGenericTeamId TeamId = FGenericTeamId::NoTeam;
+	};
+
+	void RebuildSnapshot();
+	FIntPoint GetCell(const FVector& Location) const;
+	ASolaraqShipBase* FindTarget(const USolaraqGimbalGunComponent& Gun) const;
+	void UpdateTurret(FTurret& Turret, double Now);
+
+	TArray<FTurret> Turrets;
+	int32 Cursor = 0;
+
+	TArray<FCandidate> Candidates;
+	TMap<FIntPoint, TArray<int32>> CandidateCells;
+	float TimeUntilSnapshot = 0.0f;
+
+	float FireTokens = 0.0f;
+};
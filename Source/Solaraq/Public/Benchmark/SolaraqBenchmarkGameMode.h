@@ -0,0 +1,145 @@
+// SolaraqBenchmarkGameMode.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/GameModeBase.h"
+#include "Engine/EngineBaseTypes.h"
+#include "SolaraqBenchmarkGameMode.generated.h"
+
+class ASolaraqEnemyShip;
+class ASolaraqAIController;
+class ASolaraqBenchmarkGameMode;
+
+/** Tick function used to bracket the physics tick groups so we can time the game thread's physics window. */
+USTRUCT()
+struct FSolaraqBenchmarkTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/** Game mode receiving the callback. */
+	TWeakObjectPtr<ASolaraqBenchmarkGameMode> Target;
+
+	/** True for the tick registered in TG_EndPhysics, false for TG_StartPhysics. */
+	bool bIsEndOfPhysics = false;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override { return TEXT("FSolaraqBenchmarkTickFunction"); }
+};
+
+template<>
+struct TStructOpsTypeTraits<FSolaraqBenchmarkTickFunction> : public TStructOpsTypeTraitsBase2<FSolaraqBenchmarkTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/**
+ * @brief Headless AI-vs-AI combat benchmark.
+ *
+ * Spawns two teams of enemy ships around the celestial bodies / asteroid fields of the loaded map,
+ * lets them fight with a fixed random seed for a fixed time and writes a JSON report with
+ * game thread / physics window / AI frame time percentiles, projectile counts and memory usage.
+ *
+ * The physics window is game thread wall time from TG_StartPhysics to TG_EndPhysics: physics-group ticks plus
+ * waiting on the scene. It is not Chaos solver time; use `stat Chaos` or Insights for that.
+ *
+ * Typical run (no rendering, fixed 60Hz step):
+ *   UnrealEditor Solaraq.uproject /Game/Maps/YourMap?game=/Script/Solaraq.SolaraqBenchmarkGameMode
+ *       -game -nullrhi -nosound -unattended -benchmark -fps=60
+ *       -BenchShips=32 -BenchSeconds=60 -BenchSeed=1337 -BenchOut=C:/Bench/run.json -BenchLabel=<commit>
+ *
+ * All -Bench* switches are optional and override the config values below.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API ASolaraqBenchmarkGameMode : public AGameModeBase
+{
+	GENERATED_BODY()
+
+public:
+	ASolaraqBenchmarkGameMode();
+
+	//~ Begin AActor Interface
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void Tick(float DeltaSeconds) override;
+	//~ End AActor Interface
+
+	/** Called from the bracketing tick functions. */
+	void OnPhysicsBracketTick(bool bIsEndOfPhysics);
+
+protected:
+	// --- Scenario ---
+
+	/** Ship Blueprint to spawn (needs ProjectileClass etc. set up). Override with -BenchShipClass=/Game/...BP_X.BP_X_C */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark")
+	TSoftClassPtr<ASolaraqEnemyShip> ShipClass;
+
+	/** Controller spawned for every benchmark ship. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark")
+	TSubclassOf<ASolaraqAIController> AIControllerClass;
+
+	/** Ships spawned per team. -BenchShips= */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark", meta = (ClampMin = "1"))
+	int32 ShipsPerTeam = 16;
+
+	/** Team IDs of the two sides (see USolaraqTeamSettings). They must be hostile to each other. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark")
+	uint8 TeamAId = 0;
+
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark")
+	uint8 TeamBId = 1;
+
+	/** Measured time in seconds (after warmup). -BenchSeconds= */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark", meta = (ClampMin = "1.0"))
+	float DurationSeconds = 60.0f;
+
+	/** Frames during this initial period are simulated but not recorded (spawn hitches, streaming). */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark", meta = (ClampMin = "0.0"))
+	float WarmupSeconds = 3.0f;
+
+	/** Seed for spawn placement and FMath::Rand*. -BenchSeed= */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark")
+	int32 RandomSeed = 1337;
+
+	/** Distance from each anchor (celestial body / asteroid field) at which teams are spawned. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark", meta = (ClampMin = "0.0"))
+	float SpawnRingRadius = 6000.0f;
+
+	/** Random jitter applied to each spawn position. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark", meta = (ClampMin = "0.0"))
+	float SpawnJitter = 1500.0f;
+
+	/** Quit the process once the report has been written. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Benchmark")
+	bool bExitWhenDone = true;
+
+private:
+	void ParseCommandLineOverrides();
+	void SpawnTeams();
+	ASolaraqEnemyShip* SpawnBenchmarkShip(UClass* InShipClass, const FVector& Location, const FRotator& Rotation, uint8 InTeamId);
+	void RecordFrame(float DeltaSeconds);
+	void FinishBenchmark();
+	FString GetReportPath() const;
+
+	/** Per-frame samples in milliseconds, only recorded after warmup. */
+	TArray<float> GameThreadMs;
+	TArray<float> PhysicsWindowMs;
+	TArray<float> AIMs;
+	TArray<int32> LiveProjectileSamples;
+
+	FSolaraqBenchmarkTickFunction StartPhysicsTick;
+	FSolaraqBenchmarkTickFunction EndPhysicsTick;
+	double PhysicsWindowStart = 0.0;
+	double LastPhysicsWindowSeconds = 0.0;
+	double LastAISeconds = 0.0;
+
+	TArray<TWeakObjectPtr<ASolaraqEnemyShip>> TeamAShips;
+	TArray<TWeakObjectPtr<ASolaraqEnemyShip>> TeamBShips;
+
+	float ElapsedSeconds = 0.0f;
+	uint64 MemoryUsedAtStart = 0;
+	uint64 PeakMemoryUsed = 0;
+	FString ReportPathOverride;
+	FString RunLabel;
+	bool bRunning = false;
+};
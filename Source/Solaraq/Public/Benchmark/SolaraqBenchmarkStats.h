@@ -0,0 +1,39 @@
+// SolaraqBenchmarkStats.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * Cheap, game-thread-only counters fed by gameplay code and read by ASolaraqBenchmarkGameMode.
+ * Always compiled in; the cost is a couple of integer/double adds per event.
+ */
+namespace SolaraqBenchmark
+{
+	struct FCounters
+	{
+		/** Seconds spent in AI controller ticks since the benchmark last consumed the value. */
+		double AISeconds = 0.0;
+
+		/** Projectiles currently alive in the world. */
+		int32 LiveProjectiles = 0;
+
+		/** Projectiles spawned since the counters were last reset. */
+		int64 ProjectilesSpawned = 0;
+
+		void Reset() { *this = FCounters(); }
+	};
+
+	/** Global counters. Game thread only. */
+	SOLARAQ_API extern FCounters GCounters;
+
+	/** Adds the lifetime of the scope to GCounters.AISeconds. */
+	struct FScopedAITimer
+	{
+		const double StartTime;
+
+		FScopedAITimer() : StartTime(FPlatformTime::Seconds()) {}
+		~FScopedAITimer() { GCounters.AISeconds += FPlatformTime::Seconds() - StartTime; }
+	};
+}
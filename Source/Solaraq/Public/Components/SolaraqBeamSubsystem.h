@@ -0,0 +1,54 @@
+// SolaraqBeamSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "SolaraqBeamSubsystem.generated.h"
+
+class USolaraqBeamWeaponComponent;
+
+/**
+ * @brief Traces and applies damage for every firing beam weapon in one pass per frame.
+ *
+ * Each firing beam issues one async line trace per frame on the Projectile channel; results arrive with the next
+ * frame's async batch and become the beam's current hit. The server turns accumulated beam time into damage at each beam's DamageTickRate
+ * against that hit. Runs on server and clients (clients only use the hit for the visual beam length).
+ */
+UCLASS()
+class SOLARAQ_API USolaraqBeamSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqBeamSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	void RegisterBeam(USolaraqBeamWeaponComponent* Beam);
+	void UnregisterBeam(USolaraqBeamWeaponComponent* Beam);
+
+	int32 GetNumFiringBeams() const { return Beams.Num(); }
+
+private:
+	void ApplyBeamDamage(USolaraqBeamWeaponComponent& Beam, float DeltaTime);
+	void OnTraceCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceData);
+
+	/** Firing beams only. */
+	TArray<USolaraqBeamWeaponComponent*> Beams;
+
+	TMap<uint32, TWeakObjectPtr<USolaraqBeamWeaponComponent>> InFlight;
+	uint32 NextRequestId = 1;
+
+	FTraceDelegate TraceDelegate;
+};
@@ -0,0 +1,100 @@
+// SolaraqBeamWeaponComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "SolaraqBeamWeaponComponent.generated.h"
+
+class UStaticMeshComponent;
+
+/**
+ * @brief Continuous hitscan beam along the component's forward vector.
+ *
+ * Traces and damage are run for all firing beams by USolaraqBeamSubsystem (async traces, one batch per frame; damage
+ * at DamageTickRate). Only bFiring replicates; clients trace locally for the visual beam length.
+ *
+ * Attach under an ASolaraqShipBase MuzzlePoint to replace the ship's main weapon, or under a
+ * USolaraqGimbalGunComponent to make it a beam turret. Their fire requests call SustainFire.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class SOLARAQ_API USolaraqBeamWeaponComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+	// Traces and damage are driven in batch by the subsystem
+	friend class USolaraqBeamSubsystem;
+
+public:
+	USolaraqBeamWeaponComponent();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Server: keeps the beam on for SustainTimeout more seconds. For repeating fire input / AI fire calls. */
+	void SustainFire();
+
+	/** Server: beam stays on until StopFiring. */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Solaraq|Beam")
+	void StartFiring();
+
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Solaraq|Beam")
+	void StopFiring();
+
+	UFUNCTION(BlueprintPure, Category = "Solaraq|Beam")
+	bool IsFiring() const { return bFiring; }
+
+	/** First beam weapon attached (directly or deeper) below Parent, or nullptr. */
+	static USolaraqBeamWeaponComponent* FindBeamBelow(const USceneComponent* Parent);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Beam", meta = (ClampMin = "0.0", ForceUnits = "cm"))
+	float Range = 4000.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Beam", meta = (ClampMin = "0.0"))
+	float DamagePerSecond = 40.0f;
+
+	/** Damage is applied this many times per second (DamagePerSecond / DamageTickRate each time). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Beam", meta = (ClampMin = "1.0"))
+	float DamageTickRate = 10.0f;
+
+	/** SustainFire keeps the beam on this long. Slightly longer than the fire input repeat interval. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Beam", meta = (ClampMin = "0.0"))
+	float SustainTimeout = 0.25f;
+
+	// --- Visuals ---
+	/** Stretched along X to the beam length. Mesh should extend along +X from its origin. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Solaraq|Beam|Visuals")
+	TObjectPtr<UStaticMeshComponent> BeamMeshComponent;
+
+	/** Length of BeamMeshComponent's mesh at X scale 1. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Beam|Visuals", meta = (ClampMin = "1.0"))
+	float BeamMeshLength = 100.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Beam|Visuals", meta = (ClampMin = "0.0"))
+	float BeamWidthScale = 0.1f;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UFUNCTION()
+	void OnRep_Firing();
+
+private:
+	void SetFiring(bool bNewFiring);
+	void UpdateBeamRegistration();
+	void SetBeamLength(float Length);
+
+	/** The only replicated beam state. */
+	UPROPERTY(ReplicatedUsing = OnRep_Firing)
+	bool bFiring = false;
+
+	// --- Server fire state ---
+	bool bHoldUntilStopped = false;
+	double LastSustainTime = 0.0;
+
+	// --- Written by USolaraqBeamSubsystem ---
+	int32 BeamSlot = INDEX_NONE;
+	TWeakObjectPtr<AActor> HitActor;
+	FVector HitLocation = FVector::ZeroVector;
+	float DamageAccumulator = 0.0f; // Seconds of beam time not yet turned into damage
+};
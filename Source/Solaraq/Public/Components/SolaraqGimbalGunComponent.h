@@ -10,21 +10,44 @@
 class ASolaraqProjectile;
 class UStaticMeshComponent;
 class APawn;
+class USolaraqBeamWeaponComponent;
+
+/** Gimbal yaw as sent over the network: both angles compressed to 16 bits (FRotator::CompressAxisToShort). */
+USTRUCT()
+struct FSolaraqGimbalYawRep
+{
+    GENERATED_BODY()
+
+    /** Authoritative yaw at the time of sending. Clients extrapolate from it. */
+    UPROPERTY()
+    uint16 ActualYaw = 0;
+
+    /** Clamped yaw the gimbal is rotating towards. */
+    UPROPERTY()
+    uint16 DesiredYaw = 0;
+};
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class SOLARAQ_API USolaraqGimbalGunComponent : public USceneComponent, public IGenericTeamAgentInterface
 {
     GENERATED_BODY()
 
+    // Rotation is driven in batch by the subsystem, which reads/writes the yaw state below
+    friend class USolaraqGimbalGunSubsystem;
+
 public:
     USolaraqGimbalGunComponent();
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 public:
-    virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    //~ Begin UActorComponent Interface
+    virtual void Activate(bool bReset = false) override;
+    virtual void Deactivate() override;
+    //~ End UActorComponent Interface
 
     //~ Begin IGenericTeamAgentInterface
     virtual FGenericTeamId GetGenericTeamId() const override;
@@ -50,6 +73,12 @@ protected:
     /** Can the gun fire right now? (Cooldown, etc.) */
     bool CanFire() const;
 
+public:
+    /** Server: fires if off cooldown. Returns true if a shot was fired. */
+    bool FireAuthoritative();
+
+protected:
+
     /** Gets the world transform of the muzzle point */
     FTransform GetMuzzleWorldTransform() const;
 
@@ -80,9 +109,30 @@ public:
     /** Called by owning actor (usually ship) to tell the gun where to aim. Client or Server. */
     void AimAtWorldLocation(const FVector& WorldTargetLocation);
 
+    /** Yaw (relative to the attach parent, like DesiredGimbalRelativeYaw) that points the gun at a world location. */
+    float GetRelativeYawTo(const FVector& WorldTargetLocation) const;
+
+    /** True if the relative yaw lies inside the constraint arc (always true without constraints). */
+    bool IsYawWithinConstraints(float RelativeYaw) const;
+
+    /** Degrees between the authoritative gimbal yaw and the clamped desired yaw. */
+    float GetAimError() const;
+
 protected:
+    /** Quantized like FSolaraqGimbalYawRep. Sent at most AimRpcRate times per second, see SendAimToServer. */
     UFUNCTION(Server, Unreliable)
-    void Server_SetDesiredYaw(float NewDesiredYaw);
+    void Server_SetDesiredYaw(uint16 NewDesiredYaw);
+
+    /** Same as Server_SetDesiredYaw, sent once the aim has settled so a dropped last update can't leave the server stale. */
+    UFUNCTION(Server, Reliable)
+    void Server_SetSettledYaw(uint16 NewDesiredYaw);
+
+    /** Owning client: sends the latest desired yaw now, or schedules it for the next AimRpcRate slot. */
+    void SendAimToServer();
+    void FlushAimToServer();
+
+    /** Owning client: reliably resends the last coalesced yaw once no aim change came in for AimSettleDelay. */
+    void SendSettledAim();
 
     /** Applies rotation constraints to a given yaw value relative to the component's parent. */
     float GetClampedRelativeYaw(float InYaw) const;
@@ -97,11 +147,26 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solaraq|GimbalGun|Aiming", meta = (ClampMin = "1.0", UIMin = "1.0", ToolTip = "How fast the gimbal can rotate in degrees per second."))
     float MaxYawRotationSpeed; // Degrees per second
 
-    UPROPERTY(ReplicatedUsing = OnRep_CurrentActualGimbalRelativeYaw)
     float CurrentActualGimbalRelativeYaw; // Yaw of the gimbal relative to its attachment parent's forward
 
+    /** Server only resends yaw once clients' extrapolation would be off by more than this many degrees. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solaraq|GimbalGun|Network", meta = (ClampMin = "0.0"))
+    float YawReplicationThreshold = 2.0f;
+
+    /** Max aim RPCs per second from the owning client. Aim changes in between are coalesced. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solaraq|GimbalGun|Network", meta = (ClampMin = "1.0"))
+    float AimRpcRate = 15.0f;
+
+    /** Server: max ReplicatedYaw updates per second. Target changes in between are coalesced, the latest one wins. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solaraq|GimbalGun|Network", meta = (ClampMin = "0.0"))
+    float MaxYawRepRate = 10.0f;
+
+    /** Seconds without aim changes after which the last yaw is resent reliably. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solaraq|GimbalGun|Network", meta = (ClampMin = "0.0"))
+    float AimSettleDelay = 0.25f;
+
     UFUNCTION()
-    void OnRep_CurrentActualGimbalRelativeYaw();
+    void OnRep_GimbalYaw();
 
 protected:
     /** The yaw the client/server wants the gun to point to, relative to parent. Constraints will be applied to this by server. */
@@ -110,6 +175,33 @@ protected:
     /** Smoothed target for client-side visuals, based on server updates or local input */
     float ClientVisualGimbalRelativeYaw;
 
+    /** Replicated to non-owners. Clients rotate CurrentActualGimbalRelativeYaw towards DesiredYaw between updates. */
+    UPROPERTY(ReplicatedUsing = OnRep_GimbalYaw)
+    FSolaraqGimbalYawRep ReplicatedYaw;
+
+    /**
+     * Server: refreshes ReplicatedYaw when the target changed, the gimbal settled or extrapolation drifted too far,
+     * at most MaxYawRepRate times per second. Returns true if an update is owed but held back by the rate limit.
+     */
+    bool UpdateReplicatedYaw();
+    double LastYawRepTime = 0.0;
+
+    /** Owning client aim RPC coalescing. */
+    double LastAimRpcTime = -1.0;
+    uint16 LastSentAimYaw = 0;
+    int32 LastAckedAimYaw = INDEX_NONE; // Yaw the server is known to hold (delivered reliably). INDEX_NONE once an unreliable send may have changed it
+    FTimerHandle AimRpcTimerHandle;
+    FTimerHandle AimSettleTimerHandle;
+
+    /** True while a local player controller drives the aim (visuals then lead the server). */
+    bool bLocallyAimed = false;
+
+    /** Index in USolaraqGimbalGunSubsystem, INDEX_NONE while not registered. */
+    int32 GimbalSlot = INDEX_NONE;
+
+    /** Pushes the current aim to the gimbal subsystem (wakes the gun if it was resting). */
+    void WakeGimbal();
+
 
     // --- CONSTRAINTS (Yaw for 2D plane) ---
 public:
@@ -122,6 +214,19 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solaraq|GimbalGun|Constraints", meta = (EditCondition = "bEnableYawConstraints", ClampMin = "0.0", ClampMax = "180.0", UIMin = "0.0", UIMax = "180.0", DisplayName = "Max Yaw Angle From Center"))
     float MaxYawAngleFromCenter; // Max deviation from ConstraintCenterRelativeYaw. E.g., 45 means a 90-degree total arc.
 
+    // --- AUTONOMOUS (station turrets) ---
+public:
+    /** Server picks targets, aims and fires on its own (see USolaraqTurretTargetingSubsystem). For guns nobody drives. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|GimbalGun|Autonomous")
+    bool bAutonomousTargeting = false;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|GimbalGun|Autonomous", meta = (EditCondition = "bAutonomousTargeting", ClampMin = "0.0"))
+    float AutonomousTargetRange = 8000.0f;
+
+    /** Only fire once the gimbal is within this many degrees of the lead point. */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|GimbalGun|Autonomous", meta = (EditCondition = "bAutonomousTargeting", ClampMin = "0.0", ClampMax = "180.0"))
+    float AutonomousFireAngleTolerance = 5.0f;
+
 #if WITH_EDITOR
     virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
     void DrawConstraintArc() const;
@@ -131,5 +236,13 @@ private:
     UPROPERTY()
     TWeakObjectPtr<APawn> OwningPawn; // The pawn that owns this component, for instigator and team ID
 
+    /** Beam weapon attached below this gun, if any (found at BeginPlay). Fires instead of ProjectileClass. */
+    UPROPERTY(Transient)
+    TObjectPtr<USolaraqBeamWeaponComponent> BeamWeapon;
+
     FGenericTeamId TeamId;
+
+    /** Registers with the gimbal (and, for autonomous server guns, turret targeting) subsystems. */
+    void RegisterWithSubsystems();
+    void UnregisterFromSubsystems();
 };
\ No newline at end of file
@@ -0,0 +1,72 @@
+// SolaraqGimbalGunSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqGimbalGunSubsystem.generated.h"
+
+class USolaraqGimbalGunComponent;
+
+/**
+ * @brief Rotates every gimbal gun in the world in one pass instead of one component tick per gun.
+ *
+ * Yaw state lives in packed arrays. Awake guns are kept at the front, so the update only walks
+ * [0, NumAwake). A gun goes to sleep once both its authoritative and visual yaw reach their targets, and is woken
+ * by WakeGun whenever it gets new aim input (AimAtWorldLocation, the aim RPC, a replicated yaw).
+ * Runs on server and clients. Everyone advances the actual yaw (clients extrapolating from the last quantized update)
+ * and the visual yaw; the server also decides when the yaw needs re-replicating.
+ */
+UCLASS()
+class SOLARAQ_API USolaraqGimbalGunSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqGimbalGunSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	void RegisterGun(USolaraqGimbalGunComponent* Gun);
+	void UnregisterGun(USolaraqGimbalGunComponent* Gun);
+
+	/** Re-reads the gun's aim targets and puts it in the update set. Cheap; call on every aim change. */
+	void WakeGun(USolaraqGimbalGunComponent* Gun);
+
+	int32 GetNumGuns() const { return Guns.Num(); }
+	int32 GetNumAwakeGuns() const { return NumAwake; }
+
+private:
+	struct FGimbalState
+	{
+		float ActualYaw = 0.0f;       // Authoritative yaw (server), or extrapolated replicated yaw (clients)
+		float VisualYaw = 0.0f;       // What the mesh shows
+		float ActualTargetYaw = 0.0f; // Clamped desired yaw
+		float MaxSpeed = 0.0f;        // Degrees per second
+		bool bAuthority = false;
+		bool bVisualFollowsActual = true; // False for the locally aiming player, whose visuals lead the server
+	};
+
+	void Wake(int32 Index);
+	void Sleep(int32 Index);
+	void SwapSlots(int32 A, int32 B);
+
+#if WITH_EDITOR
+	/** Constraint arcs of selected guns (asleep or not), drawn here so components never need to tick. */
+	void DrawEditorPreviews() const;
+#endif
+
+	// Parallel arrays, [0, NumAwake) are awake
+	TArray<USolaraqGimbalGunComponent*> Guns;
+	TArray<FGimbalState> States;
+	int32 NumAwake = 0;
+};
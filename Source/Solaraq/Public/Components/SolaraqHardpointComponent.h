@@ -0,0 +1,119 @@
+// SolaraqHardpointComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "SolaraqHardpointComponent.generated.h"
+
+class ASolaraqProjectile;
+
+/** One fixed weapon mount. Transform is relative to the hardpoint component (or to Socket on its attach parent). */
+USTRUCT(BlueprintType)
+struct SOLARAQ_API FSolaraqHardpointSlot
+{
+	GENERATED_BODY()
+
+	/** Socket on the attach parent (ship mesh) to fire from. If NAME_None or missing, Offset/Yaw are relative to the hardpoint component. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hardpoint")
+	FName Socket = NAME_None;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hardpoint")
+	FVector Offset = FVector::ZeroVector;
+
+	/** Convergence / splay, degrees. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hardpoint", meta = (UIMin = "-180.0", UIMax = "180.0"))
+	float Yaw = 0.0f;
+
+	/** Fire group this slot belongs to. Groups fire together with one request. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hardpoint", meta = (ClampMin = "0", ClampMax = "7"))
+	int32 Group = 0;
+
+	/** Overrides the ship's projectile if set. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hardpoint")
+	TSubclassOf<ASolaraqProjectile> ProjectileClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Hardpoint", meta = (ClampMin = "0.0"))
+	float HeatPerShot = 5.0f;
+};
+
+/**
+ * @brief Owns all fixed weapon mounts of a ship and fires them on one shared schedule.
+ *
+ * Instead of one weapon component per gun (each ticking, each with its own cooldown and RPC), slots are plain data.
+ * A fire group has a single cooldown; all slots share one heat value. Neither needs ticking: heat is a timeline
+ * stamped on every shot and decayed on read. FireGroup collects the ready slots and spawns the salvo in one pass.
+ * Attach to the ship mesh. Server only; clients reach it through ASolaraqShipBase::Server_RequestFireGroup.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class SOLARAQ_API USolaraqHardpointComponent : public USceneComponent
+{
+	GENERATED_BODY()
+
+public:
+	USolaraqHardpointComponent();
+
+	/** Group fired by the ship's primary fire (and therefore by AI ships). */
+	static constexpr int32 PrimaryGroup = 0;
+
+	/**
+	 * Fires every slot of the group if the group is off cooldown and the weapons aren't overheated.
+	 * @param DefaultProjectileClass Used for slots without their own ProjectileClass.
+	 * @param InheritedVelocity Added to every projectile's muzzle velocity (the ship's velocity).
+	 * @return Number of projectiles spawned.
+	 */
+	int32 FireGroup(int32 Group, TSubclassOf<ASolaraqProjectile> DefaultProjectileClass, float MuzzleSpeed, const FVector& InheritedVelocity);
+
+	bool HasSlots() const { return Slots.Num() > 0; }
+
+	/** Current heat, decayed up to now. */
+	UFUNCTION(BlueprintPure, Category = "Solaraq|Hardpoints")
+	float GetHeat() const;
+
+	/** True after reaching MaxHeat, until heat drops to OverheatRecoveryHeat. */
+	UFUNCTION(BlueprintPure, Category = "Solaraq|Hardpoints")
+	bool IsOverheated() const;
+
+	/** Sustained damage per second of one group firing continuously (heat limited). */
+	float GetDamagePerSecond(TSubclassOf<ASolaraqProjectile> DefaultProjectileClass, int32 Group = PrimaryGroup) const;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Hardpoints")
+	TArray<FSolaraqHardpointSlot> Slots;
+
+	/** Seconds between salvos of the same group. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Hardpoints", meta = (ClampMin = "0.05"))
+	float GroupFireInterval = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Hardpoints|Heat", meta = (ClampMin = "1.0"))
+	float MaxHeat = 100.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Hardpoints|Heat", meta = (ClampMin = "0.0"))
+	float HeatDissipationPerSecond = 25.0f;
+
+	/** Once overheated, weapons stay locked until heat falls to this value. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Hardpoints|Heat", meta = (ClampMin = "0.0"))
+	float OverheatRecoveryHeat = 30.0f;
+
+private:
+	struct FSalvoShot
+	{
+		UClass* ProjectileClass = nullptr;
+		FTransform Transform;
+	};
+
+	FTransform GetSlotWorldTransform(const FSolaraqHardpointSlot& Slot) const;
+
+	/** Spawns all shots of one salvo in a single pass with shared spawn parameters. */
+	void SpawnSalvo(TConstArrayView<FSalvoShot> Shots, float MuzzleSpeed, const FVector& InheritedVelocity);
+
+	/** Heat timeline: value at HeatStampTime, decays linearly afterwards. */
+	float HeatAtStamp = 0.0f;
+	double HeatStampTime = 0.0;
+	bool bOverheated = false; // Latched at MaxHeat, see IsOverheated
+
+	/** World time at which each group may fire again, indexed by group. */
+	TArray<double> GroupReadyTimes;
+
+	/** Reused per salvo. */
+	TArray<FSalvoShot> SalvoScratch;
+};
@@ -0,0 +1,98 @@
+// SolaraqSnapshotInterpolationComponent.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "SolaraqSnapshotInterpolationComponent.generated.h"
+
+struct FRepMovement;
+
+/** One timestamped server state of the owning actor. */
+struct FSolaraqMovementSnapshot
+{
+	double ServerTime = 0.0;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FVector LinearVelocity = FVector::ZeroVector;
+};
+
+/**
+ * @brief Renders a remote (simulated proxy) actor from buffered server snapshots instead of snapping to each update.
+ *
+ * The owner forwards its replicated movement with the server timestamp to ConsumeSnapshot. Each frame the actor is
+ * placed at (estimated server time - InterpolationDelay): Hermite interpolation between the two surrounding snapshots
+ * (positions + velocities as tangents), or velocity extrapolation for up to MaxExtrapolationTime when updates are
+ * late or lost. Physics simulation is switched off on the proxy while it is driven this way.
+ *
+ * Does nothing on the server or for locally controlled actors.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class SOLARAQ_API USolaraqSnapshotInterpolationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	USolaraqSnapshotInterpolationComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/**
+	 * Client: buffers a replicated movement update stamped with the server time it was gathered at.
+	 * @return False if the owner isn't a simulated proxy (the caller should apply the movement normally).
+	 */
+	bool ConsumeSnapshot(double ServerTime, const FRepMovement& Movement);
+
+	UFUNCTION(BlueprintPure, Category = "Solaraq|Network")
+	bool IsInterpolating() const { return bInterpolating; }
+
+	/**
+	 * Client: stops placing the actor and drops the buffered snapshots, e.g. while it is attached to something.
+	 * ConsumeSnapshot returns false while paused. Unpausing starts again from the next snapshot.
+	 */
+	void SetPaused(bool bInPaused);
+
+	bool IsPaused() const { return bPaused; }
+
+	/**
+	 * Server update rate of Actor: its component's ServerNetUpdateFrequency while interpolation is enabled, otherwise
+	 * the actor's own NetUpdateFrequency. Also valid on class defaults, before BeginPlay applies it.
+	 */
+	static float GetServerUpdateFrequency(const AActor* Actor);
+
+	/** How far behind the estimated server time remote actors are rendered. Cover ~2 update intervals plus jitter. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Network", meta = (ClampMin = "0.0", ForceUnits = "s"))
+	float InterpolationDelay = 0.1f;
+
+	/** Longest time the last snapshot is extrapolated along its velocity before the actor holds still. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Network", meta = (ClampMin = "0.0", ForceUnits = "s"))
+	float MaxExtrapolationTime = 0.25f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Network", meta = (ClampMin = "2", ClampMax = "64"))
+	int32 MaxSnapshots = 16;
+
+	/**
+	 * Server: owner's NetUpdateFrequency while interpolation is enabled, and its period in the replication graph.
+	 * 0 keeps the actor's own value. The owning connection still gets its own pawn at the class rate.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Network", meta = (ClampMin = "0.0"))
+	float ServerNetUpdateFrequency = 20.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Network")
+	bool bEnabled = true;
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	double GetServerTime() const;
+
+	/** Turns off proxy physics and starts ticking. */
+	void StartInterpolating();
+
+	/** Oldest first. */
+	TArray<FSolaraqMovementSnapshot> Snapshots;
+
+	bool bInterpolating = false;
+	bool bPaused = false;
+};
@@ -46,6 +46,8 @@ public:
 protected:
     // Called when the game starts or when spawned.
     virtual void BeginPlay() override;
+    // Removes our asteroids from the AI obstacle field again.
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     // This is super handy for editor-time updates! It's called when the actor is constructed in the editor,
     // or when a property is changed if "Run Construction Script on Drag" is true.
     virtual void OnConstruction(const FTransform& Transform) override;
@@ -128,6 +130,9 @@ public:
     UFUNCTION(CallInEditor, Category = "Solaraq|Asteroid Field")
     void GenerateAsteroids();
 
+    // The spline the field is laid out along (used by the AI nav graph to route around belts).
+    USplineComponent* GetSplineComponent() const { return SplineComponent; }
+
 private:
     // Helper function to get a random point within the belt volume.
     FVector GetRandomPointInBeltVolume(const FRandomStream& Stream) const;
@@ -136,6 +141,14 @@ private:
     // Helper function to calculate the final transform (position, rotation, scale) for an asteroid instance.
     FTransform CalculateInstanceTransform(const FVector& LocalPosition, const FRandomStream& Stream) const;
 
+    // Pushes every asteroid instance into the AI obstacle field (server only, called from BeginPlay).
+    void RegisterObstacles();
+    // Undoes RegisterObstacles.
+    void UnregisterObstacles();
+
+    // Handles into USolaraqObstacleFieldSubsystem, one per registered asteroid instance.
+    TArray<int32> ObstacleHandles;
+
     // A flag to prevent GenerateAsteroids from running multiple times simultaneously,
     // which can happen with editor events.
     bool bIsGenerating;
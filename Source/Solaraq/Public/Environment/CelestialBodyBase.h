@@ -39,6 +39,8 @@ public:
 	virtual void OnConstruction(const FTransform& Transform) override;
 	/** Called when the game starts or when spawned. Caches radii and validates settings. */
 	virtual void BeginPlay() override;
+	/** Removes the body from the AI obstacle field. */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~ End AActor Interface
 
 	//~ Begin UObject Interface
@@ -48,6 +50,15 @@ public:
 #endif
 	//~ End UObject Interface
 
+	/**
+	 * Radius of gravitational influence in world units (actor scale applied, same as the influence sphere).
+	 * Computed from InfluenceRadius, so it's valid before BeginPlay (e.g. in subsystem OnWorldBeginPlay).
+	 */
+	float GetInfluenceDistance() const { return InfluenceRadius * GetActorScale3D().GetAbsMin(); }
+
+	float GetGravitationalStrength() const { return GravitationalStrength; }
+	float GetGravityFalloffExponent() const { return GravityFalloffExponent; }
+
 protected:
 	// --- Components ---
 
@@ -138,6 +149,12 @@ protected:
 
 	/** Ensures radii properties are valid (non-negative) and ScalingRadius <= InfluenceRadius. Called during construction and property changes. */
 	void ValidateRadii();
+
+	/** Handle into USolaraqObstacleFieldSubsystem for the body mesh (Server-side). */
+	int32 ObstacleHandle = INDEX_NONE;
+
+	/** Keeps the obstacle on the body mesh if the body is moved or rescaled at runtime (Server-side). */
+	void OnBodyMeshTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
 };
 
 // --- END OF FILE CelestialBodyBase.h ---
\ No newline at end of file
@@ -0,0 +1,90 @@
+// SolaraqDamageSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/HitResult.h"
+#include "SolaraqDamageSubsystem.generated.h"
+
+class AController;
+class UDamageType;
+
+/** Target, total damage applied this frame, number of hits folded into it. */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnSolaraqDamageApplied, AActor* /*Target*/, float /*Damage*/, int32 /*NumHits*/);
+
+/** Target, killer (instigator of the last hit in the killing frame), damage causer of that hit. */
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FOnSolaraqTargetKilled, AActor* /*Target*/, AController* /*Killer*/, AActor* /*DamageCauser*/);
+
+/** Damage queued against one target during the current frame. */
+struct FSolaraqPendingDamage
+{
+	TWeakObjectPtr<AActor> Target;
+	float TotalDamage = 0.0f;
+	int32 NumHits = 0;
+
+	// Taken from the latest hit; it gets kill credit and drives impact direction
+	FHitResult LastHit;
+	FVector LastShotDirection = FVector::ZeroVector;
+	TSubclassOf<UDamageType> DamageTypeClass;
+	TWeakObjectPtr<AController> Instigator;
+	TWeakObjectPtr<AActor> DamageCauser;
+};
+
+/**
+ * @brief Coalesces all weapon damage dealt in a frame into one TakeDamage call per target (server only).
+ *
+ * Projectiles, salvos and beams queue their hits here instead of calling TakeDamage directly. At the end of the frame
+ * each damaged target gets a single point-damage event carrying the summed amount, so health is clamped, logged and
+ * dirtied for replication once no matter how many hits landed. OnDamageApplied and OnTargetKilled fire once per
+ * target per frame with the aggregated result.
+ */
+UCLASS()
+class SOLARAQ_API USolaraqDamageSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqDamageSubsystem* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Queues point damage against Target for this frame's flush. Falls back to an immediate TakeDamage when the world
+	 * has no damage subsystem. Server only; calls on clients are ignored.
+	 */
+	static void QueuePointDamage(AActor* Target, float Damage, const FHitResult& Hit, const FVector& ShotDirection,
+		TSubclassOf<UDamageType> DamageTypeClass, AController* Instigator, AActor* DamageCauser);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Applies everything queued so far. Called by Tick; safe to call early. */
+	void FlushPendingDamage();
+
+	int32 GetNumPendingTargets() const { return Pending.Num(); }
+
+	FOnSolaraqDamageApplied OnDamageApplied;
+	FOnSolaraqTargetKilled OnTargetKilled;
+
+private:
+	void AddDamage(AActor* Target, float Damage, const FHitResult& Hit, const FVector& ShotDirection,
+		TSubclassOf<UDamageType> DamageTypeClass, AController* Instigator, AActor* DamageCauser);
+
+	static bool IsTargetDead(const AActor& Target);
+
+	/** One entry per damaged target, in first-hit order. */
+	TArray<FSolaraqPendingDamage> Pending;
+
+	/** Target -> index in Pending. */
+	TMap<TWeakObjectPtr<AActor>, int32> PendingIndex;
+
+	/** Entries being applied by FlushPendingDamage; only non-empty during a flush. */
+	TArray<FSolaraqPendingDamage> Flushing;
+};
@@ -0,0 +1,105 @@
+// SolaraqLagCompensationSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqLagCompensationSubsystem.generated.h"
+
+class AController;
+class ASolaraqShipBase;
+
+/**
+ * @brief Server-side position history of every ship, for validating hits against what a remote shooter saw.
+ *
+ * Ships register on the server and are sampled once per server tick (at most every MinSampleInterval) into a ring of
+ * MaxHistorySamples entries. Storage is structure-of-arrays: one shared timestamp ring plus per-ship blocks of
+ * locations and yaws, so memory is MaxHistorySamples * 28 bytes per ship and a rewind query touches one timestamp
+ * bracket then one pair of entries per ship.
+ *
+ * GetViewTime(Shooter) estimates the server time a client's view showed (half its ping plus ViewInterpolationDelay,
+ * capped at MaxRewindTime); the *AtTime queries rewind ships to that time.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqLagCompensationSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Starts recording the ship (server). Its whole history is seeded with the current pose. Returns a handle. */
+	int32 RegisterShip(ASolaraqShipBase* Ship);
+
+	/** Stops recording and resets the handle to INDEX_NONE. */
+	void UnregisterShip(int32& Handle);
+
+	/** Server time the shooter's screen was showing. Returns the current time for local or AI shooters. */
+	double GetViewTime(const AController* Shooter) const;
+
+	/** Ship pose at Time, interpolated between samples (clamped to the recorded window). False if not recorded. */
+	bool GetShipTransformAtTime(const ASolaraqShipBase* Ship, double Time, FTransform& OutTransform) const;
+
+	/**
+	 * Tests the segment against every recorded ship as it was at Time (ship collision radius + Radius).
+	 * @return The ship hit closest to Start, or nullptr. OutDistance is measured from Start.
+	 */
+	ASolaraqShipBase* SegmentTestAtTime(const FVector& Start, const FVector& End, float Radius, double Time,
+		const AActor* IgnoreActor, float& OutDistance) const;
+
+	int32 GetHistoryBytesPerShip() const { return HistoryLength * (sizeof(FVector) + sizeof(float)); }
+
+protected:
+	/** Samples kept per ship; bounds memory. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Network|LagCompensation", meta = (ClampMin = "2", ClampMax = "256"))
+	int32 MaxHistorySamples = 32;
+
+	/** Minimum seconds between samples. 0 samples every server tick. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Network|LagCompensation", meta = (ClampMin = "0.0"))
+	float MinSampleInterval = 0.0f;
+
+	/** Furthest back a shooter may be compensated, whatever their ping. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Network|LagCompensation", meta = (ClampMin = "0.0"))
+	float MaxRewindTime = 0.3f;
+
+	/** How far behind the latest server state clients render remote ships. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Network|LagCompensation", meta = (ClampMin = "0.0"))
+	float ViewInterpolationDelay = 0.1f;
+
+private:
+	/** Finds the two ring entries around Time. Alpha blends Older -> Newer. */
+	bool FindSampleBracket(double Time, int32& OutOlder, int32& OutNewer, float& OutAlpha) const;
+
+	FVector LerpLocation(int32 Slot, int32 Older, int32 Newer, float Alpha) const
+	{
+		return FMath::Lerp(Locations[Slot * HistoryLength + Older], Locations[Slot * HistoryLength + Newer], Alpha);
+	}
+
+	int32 HistoryLength = 0;
+
+	// --- Timestamp ring (shared by all ships) ---
+	TArray<double> SampleTimes;
+	int32 Head = INDEX_NONE;
+	int32 NumSamples = 0;
+
+	// --- Per-ship data; history blocks are HistoryLength entries at Slot * HistoryLength ---
+	TArray<TWeakObjectPtr<ASolaraqShipBase>> Ships;
+	TArray<float> Radii;
+	TArray<FVector> Locations;
+	TArray<float> Yaws;
+
+	/** Unused slots, reused before the arrays grow. */
+	TArray<int32> FreeSlots;
+};
@@ -6,6 +6,7 @@
 #include "GameFramework/Actor.h"
 #include "GenericTeamAgentInterface.h" // For team affiliation
 #include "Chaos/ChaosGameplayEventDispatcher.h" // For FChaosPhysicsCollisionInfo
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h" // FSolaraqTeamHandle
 #include "SolaraqDestructibleObjectBase.generated.h"
 
 class UGeometryCollectionComponent; // Replaced UStaticMeshComponent
@@ -23,6 +24,7 @@ public:
 
     //~ Begin AActor Interface
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     //~ End AActor Interface
@@ -93,6 +95,15 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Team")
     FGenericTeamId TeamId = FGenericTeamId(2); // Example: Team 2 for neutral/environment
 
+    // Handle into USolaraqTeamSubsystem so AI attitude checks against us skip the interface cast
+    FSolaraqTeamHandle TeamHandle;
+
+    // Handle into USolaraqObstacleFieldSubsystem while we're intact (Server only)
+    int32 ObstacleHandle = INDEX_NONE;
+
+    // Keeps the obstacle footprint on the root when it is moved (Server only)
+    void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
     // Server function to handle the actual destruction logic
     virtual void HandleDestruction(AActor* DamageCauser, const FDamageEvent& InstigatingDamageEvent);
 
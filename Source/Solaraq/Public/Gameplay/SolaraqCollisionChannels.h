@@ -0,0 +1,15 @@
+// SolaraqCollisionChannels.h
+
+#pragma once
+
+#include "Engine/EngineTypes.h"
+
+// Custom collision channels, as set up in Config/DefaultEngine.ini ([/Script/Engine.CollisionProfile]).
+// Keep these in sync with the ini if channels are added or reordered.
+
+/**
+ * "Projectile" object/trace channel. Blocked by world geometry and destructibles, overlapped by ships,
+ * ignored by trigger volumes such as celestial influence spheres and pickup spheres.
+ * Trace on it to find what a shot would actually hit.
+ */
+#define ECC_SolaraqProjectile ECC_GameTraceChannel1
@@ -0,0 +1,50 @@
+// SolaraqTeamSettings.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "GenericTeamAgentInterface.h"
+#include "SolaraqTeamSettings.generated.h"
+
+/**
+ * One row of the faction attitude matrix.
+ * The row index in USolaraqTeamSettings::Factions IS the FGenericTeamId of the faction.
+ */
+USTRUCT(BlueprintType)
+struct FSolaraqFactionDefinition
+{
+	GENERATED_BODY()
+
+	/** Designer-facing name of the faction (Player, Pirates, Outpost...). Only used for display/logging. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Team")
+	FName FactionName;
+
+	/**
+	 * Attitude of this faction towards every faction, indexed by the other faction's team ID.
+	 * Missing entries fall back to Friendly (same team) / Hostile (different team).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Solaraq|Team")
+	TArray<TEnumAsByte<ETeamAttitude::Type>> AttitudeTowards;
+};
+
+/**
+ * Project settings holding the data-driven faction attitude matrix (Project Settings -> Game -> Solaraq Teams).
+ * Read once by USolaraqTeamSubsystem when a world starts.
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Solaraq Teams"))
+class SOLARAQ_API USolaraqTeamSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	USolaraqTeamSettings();
+
+	/** The N x N attitude matrix. Row index == team ID. */
+	UPROPERTY(Config, EditAnywhere, Category = "Solaraq|Team", meta = (TitleProperty = "FactionName"))
+	TArray<FSolaraqFactionDefinition> Factions;
+
+	//~ Begin UDeveloperSettings Interface
+	virtual FName GetCategoryName() const override { return TEXT("Game"); }
+	//~ End UDeveloperSettings Interface
+};
@@ -0,0 +1,116 @@
+// SolaraqTeamSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GenericTeamAgentInterface.h"
+#include "UObject/ObjectKey.h"
+#include "SolaraqTeamSubsystem.generated.h"
+
+class AActor;
+
+/** Lightweight handle into the team registry. Stored by registered actors, cheap to copy. */
+struct FSolaraqTeamHandle
+{
+	int32 Index = INDEX_NONE;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+	void Reset() { Index = INDEX_NONE; }
+};
+
+/**
+ * @brief Per-world team registry and faction attitude lookup.
+ *
+ * Replaces the per-query interface casting in GetTeamAttitudeTowards:
+ * - Every team-aware actor (ships, destructibles) registers once and gets a handle.
+ * - The effective FGenericTeamId of each actor is cached in a flat, handle-indexed array.
+ *   For pawns the controller's team wins over the pawn's own team (kept up to date via NotifyControllerChanged).
+ * - Attitudes come from a flattened N x N matrix built from USolaraqTeamSettings, so any number of factions is supported.
+ *
+ * Attitude queries are a single map lookup (actor -> handle) plus two array reads.
+ */
+UCLASS()
+class SOLARAQ_API USolaraqTeamSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqTeamSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	// --- Registration ---
+
+	/** Registers (or re-registers) an actor with the given effective team. Returns the handle the actor should keep. */
+	FSolaraqTeamHandle RegisterTeamAgent(const AActor* Actor, FGenericTeamId InTeamId);
+
+	/** Removes the actor from the registry and resets the handle. Safe to call with an invalid handle. */
+	void UnregisterTeamAgent(FSolaraqTeamHandle& Handle);
+
+	/** Updates the cached team of an already registered actor (e.g. after a possession change). */
+	void SetTeamId(const FSolaraqTeamHandle& Handle, FGenericTeamId InTeamId);
+
+	/** Returns the cached team for a handle, or NoTeam for invalid handles. */
+	FGenericTeamId GetTeamId(const FSolaraqTeamHandle& Handle) const
+	{
+		return TeamIds.IsValidIndex(Handle.Index) ? TeamIds[Handle.Index] : FGenericTeamId::NoTeam;
+	}
+
+	/** Returns the cached team for an actor. Falls back to ResolveTeamIdSlow for actors that never registered. */
+	FGenericTeamId FindTeamId(const AActor& Actor) const;
+
+	// --- Attitude Queries ---
+
+	/** Matrix lookup. Teams outside the matrix use the legacy rule: same team Friendly, NoTeam Neutral, otherwise Hostile. */
+	ETeamAttitude::Type GetAttitude(FGenericTeamId FromTeam, FGenericTeamId ToTeam) const
+	{
+		if (FromTeam.GetId() < NumFactions && ToTeam.GetId() < NumFactions)
+		{
+			return static_cast<ETeamAttitude::Type>(AttitudeMatrix[FromTeam.GetId() * NumFactions + ToTeam.GetId()]);
+		}
+		return GetDefaultAttitude(FromTeam, ToTeam);
+	}
+
+	/** Attitude of a team towards an actor, using the cached team of the actor. */
+	ETeamAttitude::Type GetAttitudeTowards(FGenericTeamId FromTeam, const AActor& Other) const
+	{
+		return GetAttitude(FromTeam, FindTeamId(Other));
+	}
+
+	/**
+	 * Uncached team resolution used at registration time and for unregistered actors.
+	 * Pawns: controller team first, then the pawn itself. Other actors: the actor itself.
+	 */
+	static FGenericTeamId ResolveTeamIdSlow(const AActor& Actor);
+
+	/** Number of factions defined in the attitude matrix. */
+	int32 GetNumFactions() const { return NumFactions; }
+
+private:
+	static ETeamAttitude::Type GetDefaultAttitude(FGenericTeamId FromTeam, FGenericTeamId ToTeam);
+
+	/** Flattens USolaraqTeamSettings::Factions into AttitudeMatrix. */
+	void BuildAttitudeMatrix();
+
+	/** Cached effective team per handle. Unused slots hold NoTeam. */
+	TArray<FGenericTeamId> TeamIds;
+
+	/** Owning actor per handle, parallel to TeamIds. Only used to clean up ActorToHandle. */
+	TArray<TObjectKey<AActor>> HandleOwners;
+
+	/** Recycled handle indices. */
+	TArray<int32> FreeHandles;
+
+	/** Actor -> handle lookup used by attitude queries against arbitrary actors. */
+	TMap<TObjectKey<AActor>, int32> ActorToHandle;
+
+	/** Row-major NumFactions x NumFactions matrix of ETeamAttitude::Type values. */
+	TArray<uint8> AttitudeMatrix;
+
+	int32 NumFactions = 0;
+};
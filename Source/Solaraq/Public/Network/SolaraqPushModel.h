@@ -0,0 +1,42 @@
+// SolaraqPushModel.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+/**
+ * Use instead of MARK_PROPERTY_DIRTY_FROM_NAME for Solaraq's push-based properties.
+ *
+ * Same behaviour in shipping code. Dev builds with automation tests also record each mark, so a test can check that
+ * every server write to a push-based property was marked (see SolaraqPushModelTests.cpp). The engine only tracks
+ * dirty state for objects a net driver is replicating, which a test world doesn't have.
+ */
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SolaraqPushModel
+{
+	/** Starts recording marks, dropping anything recorded before. */
+	SOLARAQ_API void BeginRecording();
+	SOLARAQ_API void EndRecording();
+	SOLARAQ_API bool IsRecording();
+
+	SOLARAQ_API void RecordPropertyDirty(const UObject* Object, FName PropertyName);
+	SOLARAQ_API bool WasPropertyMarkedDirty(const UObject* Object, FName PropertyName);
+}
+
+#define SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ClassName, PropertyName, Object) \
+	do \
+	{ \
+		MARK_PROPERTY_DIRTY_FROM_NAME(ClassName, PropertyName, Object); \
+		if (SolaraqPushModel::IsRecording()) \
+		{ \
+			SolaraqPushModel::RecordPropertyDirty(Object, FName(TEXT(#PropertyName))); \
+		} \
+	} while (0)
+
+#else
+
+#define SOLARAQ_MARK_PROPERTY_DIRTY_FROM_NAME(ClassName, PropertyName, Object) MARK_PROPERTY_DIRTY_FROM_NAME(ClassName, PropertyName, Object)
+
+#endif
@@ -0,0 +1,120 @@
+// SolaraqReplicationGraph.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "SolaraqReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+
+/** How an actor class is routed into the graph. */
+UENUM()
+enum class ESolaraqRepNodeMapping : uint8
+{
+	NotRouted,				// Not replicated through the graph (e.g. player controllers: gathered by the owner node)
+	AlwaysRelevant,			// Global list: celestial bodies, asteroid fields, game/player state
+	RelevantOwnerOnly,		// Per-connection list of the owning connection
+	Spatialize_Static,		// Grid, never moves (cell computed once)
+	Spatialize_Dynamic,		// Grid, re-celled every frame: ships, projectiles, pickups, satellites
+	Spatialize_Dormancy,	// Grid, static while dormant and dynamic while awake: destructibles
+};
+
+/**
+ * @brief Per-connection node: the connection's own player controller, view target and player state, plus actors only
+ * relevant to their owner. Gathered fresh every frame from the connection's viewers.
+ *
+ * The connection's own pawn replicates to it at OwnPawnPeriodFrame instead of the reduced rate other connections get
+ * it at: snapshot interpolation only smooths simulated proxies, the owner needs its corrections promptly.
+ */
+UCLASS()
+class SOLARAQ_API USolaraqReplicationGraphNode_OwnedActors : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	void AddOwnedActor(AActor* Actor) { OwnedActors.AddUnique(Actor); }
+	void RemoveOwnedActor(AActor* Actor) { OwnedActors.RemoveSingleSwap(Actor); }
+
+	void SetOwnPawnPeriodFrame(uint32 InPeriodFrame) { OwnPawnPeriodFrame = InPeriodFrame; }
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> OwnedActors;
+
+	/** Pawns currently on OwnPawnPeriodFrame for this connection; restored to their global period once unpossessed. */
+	TArray<TWeakObjectPtr<AActor>> FullRatePawns;
+
+	uint32 OwnPawnPeriodFrame = 1;
+};
+
+/**
+ * @brief Replication graph for Solaraq: replaces per-actor, per-connection relevancy checks.
+ *
+ * - Ships, projectiles, pickups and satellites sit in a 2D grid on the play plane (dynamic, re-celled every frame);
+ *   destructibles are in the grid through dormancy. A connection only considers the cells around its viewer.
+ * - Celestial bodies, asteroid fields and game / player state are in one always-relevant list shared by everyone.
+ * - Each connection gets its own node for its controller, view target and owner-only actors.
+ *
+ * Replication period and cull distance per class come from the class defaults (NetUpdateFrequency,
+ * NetCullDistanceSquared). Actors with snapshot interpolation use its ServerNetUpdateFrequency instead, per actor.
+ * Enabled via ReplicationDriverClassName in DefaultEngine.ini.
+ */
+UCLASS(Transient, Config = Engine)
+class SOLARAQ_API USolaraqReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	//~ Begin UReplicationGraph Interface
+	virtual void ResetGameWorldState() override;
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void OnRemoveConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	//~ End UReplicationGraph Interface
+
+protected:
+	/** Edge length of a grid cell. Roughly the ship cull distance keeps each gather to the 3x3 cells around a viewer. */
+	UPROPERTY(Config)
+	float GridCellSize = 20000.0f;
+
+	/** Grid origin; must be below the smallest X/Y any spatialized actor reaches. */
+	UPROPERTY(Config)
+	float SpatialBiasX = -500000.0f;
+
+	UPROPERTY(Config)
+	float SpatialBiasY = -500000.0f;
+
+	/** Always-relevant static actors (celestials, asteroid fields) are re-checked this often. */
+	UPROPERTY(Config)
+	float StaticActorUpdateInterval = 2.0f;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UNetReplicationGraphConnection>, TObjectPtr<USolaraqReplicationGraphNode_OwnedActors>> OwnedActorNodes;
+
+private:
+	ESolaraqRepNodeMapping GetMappingPolicy(const UClass* Class);
+
+	/** Owner-only actor to its connection's node. False if the connection isn't known yet. */
+	bool RouteOwnedActor(AActor* Actor);
+
+	/** Replication period in frames for an update frequency, at the server tick rate. */
+	uint32 GetPeriodFrames(float UpdateFrequency) const;
+
+	TMap<const UClass*, ESolaraqRepNodeMapping> MappingCache;
+
+	/** Owner-only actors spawned before their connection had a node. */
+	TArray<TWeakObjectPtr<AActor>> PendingOwnedActors;
+};
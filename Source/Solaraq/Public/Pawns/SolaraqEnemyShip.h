@@ -7,6 +7,7 @@
 #include "Pawns/SolaraqShipBase.h" // Include the base class header
 #include "SolaraqEnemyShip.generated.h"
 
+class USolaraqAIProfile;
 
 /**
  * A specialized ship pawn class for AI-controlled enemies.
@@ -46,6 +47,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Solaraq|AI|Control")
 	virtual void RequestMoveForward(float Value);
 
+	/** Profile whose turning parameters TurnTowards uses. Set by the controller; nullptr = profile defaults. */
+	void SetAIProfile(USolaraqAIProfile* InProfile) { AIProfile = InProfile; }
+
 
 protected:
 	// Add any AI-specific components or variables here if needed
@@ -53,9 +57,36 @@ protected:
 
 	//~ Begin AActor Interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	//~ End AActor Interface
 
+	// --- Ship-to-Ship Avoidance (see USolaraqShipAvoidanceSubsystem) ---
+
+	/** Whether this ship class bends its heading/thrust around other AI ships. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI|Avoidance")
+	bool bEnableShipAvoidance = true;
+
+	/** Radius used for avoidance. 0 = use the collision sphere radius. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI|Avoidance", meta = (ClampMin = "0.0"))
+	float AvoidanceRadius = 0.0f;
+
+	/** Seconds ahead in which collisions with other ships are avoided. Heavy ships want a longer horizon. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI|Avoidance", meta = (ClampMin = "0.1"))
+	float AvoidanceTimeHorizon = 2.0f;
+
+	/** Neighbours further away than this are ignored. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI|Avoidance", meta = (ClampMin = "0.0"))
+	float AvoidanceNeighborRadius = 3000.0f;
+
+	/** Closest N neighbours considered per query. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI|Avoidance", meta = (ClampMin = "1"))
+	int32 AvoidanceMaxNeighbors = 8;
+
+	/** Hand heading/thrust to USolaraqShipSteeringSubsystem so they're applied every physics step instead of once per AI tick. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|AI|Control")
+	bool bUsePhysicsThreadSteering = true;
+
 	// --- Weapon Properties ---
 	
 	/** How far forward from the ship's center the projectile should spawn. */
@@ -81,6 +112,21 @@ protected:
 	void HandleDestruction() override;
 
 private:
+	/** Avoidance-safe version of DesiredVelocity (unchanged if avoidance is off or unavailable). */
+	FVector GetAvoidanceVelocity(const FVector& DesiredVelocity) const;
+
+	int32 AvoidanceHandle = INDEX_NONE;
+	int32 SteeringHandle = INDEX_NONE;
+
+	/** Drops the physics-thread steering registration (death / end play). */
+	void UnregisterSteering();
+
+	UPROPERTY(Transient)
+	TObjectPtr<USolaraqAIProfile> AIProfile;
+
+	/** Last thrust requested by the AI; heading is only bent around ships while actually thrusting. */
+	float LastRequestedThrust = 0.0f;
+
 	// Add internal helper variables/functions if needed
 	// Example: Track cooldown for firing weapons
 	float LastFireTime = -1.0f;
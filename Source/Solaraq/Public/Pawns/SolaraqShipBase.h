@@ -8,6 +8,8 @@
 #include "GameFramework/Pawn.h"
 #include "GenericTeamAgentInterface.h"
 #include "Components/DockingPadComponent.h" // Includes EDockingStatus
+#include "Gameplay/Teams/SolaraqTeamSubsystem.h" // FSolaraqTeamHandle
+#include "Projectiles/SolaraqSalvoTypes.h" // FSolaraqSalvoEvent
 #include "SolaraqShipBase.generated.h" // Must be last include
 
 class ASolaraqProjectile;
@@ -18,6 +20,9 @@ class USphereComponent;
 class UDamageType;
 class USceneComponent;
 class UProjectileMovementComponent;
+class USolaraqHardpointComponent;
+class USolaraqBeamWeaponComponent;
+class USolaraqSnapshotInterpolationComponent;
 class AActor;
 
 // class UCameraComponent; // If camera is added later
@@ -52,8 +57,12 @@ public:
 	virtual void Tick(float DeltaTime) override;
 	/** Called when the game starts or when spawned. Initializes health, energy, default scale. */
 	virtual void BeginPlay() override;
+	/** Unregisters the ship from world-level registries (teams). */
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	/** Returns properties that are replicated for the lifetime of the actor channel */
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	virtual void OnRep_ReplicatedMovement() override;
 	/** Handles receiving damage, updating health (Server authoritative), and triggering destruction. */
 	virtual float TakeDamage(float DamageAmount, struct FDamageEvent const& DamageEvent, class AController* EventInstigator, AActor* DamageCauser) override;
 	//~ End AActor Interface
@@ -61,6 +70,8 @@ public:
 	//~ Begin APawn Interface
 	/** Called to bind functionality to input. Base implementation does nothing; override in derived classes. */
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
+	/** Called on server and clients when the controller changes. Refreshes the cached team in the team registry. */
+	virtual void NotifyControllerChanged() override;
 	//~ End APawn Interface
 
 	// --- Generic Team Interface ---
@@ -69,12 +80,32 @@ public:
 	FGenericTeamId TeamId = FGenericTeamId(0); // Default Player Team ID = 0
 
 	virtual FGenericTeamId GetGenericTeamId() const override;
+	virtual void SetGenericTeamId(const FGenericTeamId& NewTeamId) override;
 	virtual ETeamAttitude::Type GetTeamAttitudeTowards(const AActor& Other) const override;
 	// --- End Generic Team Interface ---
 
+	/** (Re)registers this ship with the team registry using its current effective team. Call after a team change. */
+	void RefreshTeamRegistration();
+
+protected:
+	/** Handle into USolaraqTeamSubsystem. Caches the effective team (controller team first, then TeamId). */
+	FSolaraqTeamHandle TeamHandle;
+
+	/** Handle into USolaraqThreatMapSubsystem (server only). */
+	int32 ThreatSourceHandle = INDEX_NONE;
+
+	/** Handle into USolaraqLagCompensationSubsystem's position history (server only). */
+	int32 LagCompensationHandle = INDEX_NONE;
+	friend class USolaraqLagCompensationSubsystem;
+
+public:
+
 	// Getter for projectile speed used by AI prediction
 	UFUNCTION(BlueprintPure, Category="Weapon") // BlueprintPure means it doesn't change state
 	float GetProjectileMuzzleSpeed() const { return ProjectileMuzzleSpeed; }
+
+	/** Where the main weapon fires from (actor location if there is no MuzzlePoint). Used by AI shot-lane checks. */
+	FVector GetMuzzleLocation() const { return MuzzlePoint ? MuzzlePoint->GetComponentLocation() : GetActorLocation(); }
 	
 protected:
 	// --- Components ---
@@ -95,6 +126,27 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Solaraq|Components", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<USceneComponent> MuzzlePoint;
 
+	/** Fixed weapon mounts. When it has slots it replaces the single MuzzlePoint weapon. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Solaraq|Components")
+	TObjectPtr<USolaraqHardpointComponent> Hardpoints;
+
+	/** Beam weapon attached below MuzzlePoint, if any (found at BeginPlay). Replaces the main weapon. */
+	UPROPERTY(Transient)
+	TObjectPtr<USolaraqBeamWeaponComponent> MainBeamWeapon;
+
+	/** Smooths this ship on other clients from buffered movement updates. */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Solaraq|Components")
+	TObjectPtr<USolaraqSnapshotInterpolationComponent> SnapshotInterpolation;
+
+	/** Server time ReplicatedMovement was gathered at. Replicates alongside it as the snapshot timestamp. */
+	UPROPERTY(Replicated)
+	double ReplicatedMovementTime = 0.0;
+
+	// Movement last stamped, so an unchanged (resting) ship doesn't resend its timestamp
+	FVector StampedMovementLocation = FVector::ZeroVector;
+	FVector StampedMovementVelocity = FVector::ZeroVector;
+	FRotator StampedMovementRotation = FRotator::ZeroRotator;
+
 	// --- Movement Properties ---
 
 	/** Base force applied for forward/backward thrust (scaled by input). */
@@ -178,6 +230,10 @@ protected: // Keep protected or make EditDefaultsOnly
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq|Weapon", meta = (ClampMin = "0.0", ForceUnits = "cm/s"))
 	float ProjectileMuzzleSpeed = 8000.0f;
 
+	/** If set, the main weapon fires this spread pattern (no projectile actors) instead of ProjectileClass. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|Weapon")
+	TObjectPtr<USolaraqSalvoPattern> SalvoPattern;
+
 	/** How often the ship can fire (seconds). */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Solaraq|Weapon", meta = (ClampMin = "0.05"))
 	float FireRate = 0.5f;
@@ -194,6 +250,27 @@ protected:
 	 * Designed to be called by AI or Player request functions.
 	 */
 	virtual void PerformFireWeapon();
+
+	/** Sends one salvo event from the MuzzlePoint (Server-side). Cooldown is checked by the caller. */
+	void FireSalvo();
+
+	/** One event per shot; every machine rebuilds and simulates the pellets in USolaraqSalvoSubsystem. */
+	UFUNCTION(NetMulticast, Unreliable)
+	void Multicast_FireSalvo(const FSolaraqSalvoEvent& SalvoEvent);
+
+	/** Fires one hardpoint group (Server-side). Returns the number of projectiles spawned. */
+	int32 FireWeaponGroup(int32 GroupIndex);
+
+	/** Missile lock: the AI's current target, else the nearest hostile ship inside MissileLockAngle of the nose. */
+	AActor* FindMissileTarget() const;
+
+	/** Half-angle (degrees) of the forward cone searched for a missile lock when not AI controlled. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|Weapon", meta = (ClampMin = "0.0", ClampMax = "180.0"))
+	float MissileLockAngle = 30.0f;
+
+	/** Max distance for a missile lock when not AI controlled. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Solaraq|Weapon", meta = (ClampMin = "0.0", ForceUnits="cm"))
+	float MissileLockRange = 20000.0f;
 	
 	
 	// --- Speed Clamping ---
@@ -297,6 +374,10 @@ public:
 	/** Server RPC called by the client player to request firing the weapon. */
 	UFUNCTION(Server, Reliable, BlueprintCallable, Category = "Solaraq|Weapon") // Make callable if needed from BP input
 	void Server_RequestFire();
+
+	/** Server RPC: fires every hardpoint in the group with one request. */
+	UFUNCTION(Server, Reliable, BlueprintCallable, Category = "Solaraq|Weapon")
+	void Server_RequestFireGroup(uint8 GroupIndex);
 	
 	// --- Replication Notifiers (Called on Clients) ---
 protected:
@@ -421,6 +502,21 @@ public:
 	/** Returns true if the ship's health is at or below zero and the destruction process has started. */
 	UFUNCTION(BlueprintPure, Category = "Solaraq|Health")
 	bool IsDead() const { return bIsDead; }
+
+	/** Gets the current health value. */
+	float GetCurrentHealth() const { return CurrentHealth; }
+
+	/** Gets the maximum health value. */
+	float GetMaxHealth() const { return MaxHealth; }
+
+	/** Sustained primary weapon damage per second (projectile damage / fire rate). Used by the abstract combat model. */
+	float GetWeaponDamagePerSecond() const;
+
+	/** Distance a primary projectile covers before expiring (muzzle speed * lifespan). 0 if unknown or unlimited. */
+	float GetWeaponRange() const;
+
+	/** Server only. Sets health directly (no damage events), e.g. when restoring a ship from an abstract combat record. */
+	void RestoreHealth(float NewHealth);
 };
 
 
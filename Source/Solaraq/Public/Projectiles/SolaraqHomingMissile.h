@@ -0,0 +1,97 @@
+// SolaraqHomingMissile.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Projectiles/SolaraqProjectile.h"
+#include "Engine/NetSerialization.h"
+#include "SolaraqHomingMissile.generated.h"
+
+/** Everything a client needs to fly a missile itself. Changes once per launch. */
+USTRUCT()
+struct FSolaraqMissileLaunchState
+{
+	GENERATED_BODY()
+
+	/** Sent as a network GUID (the target's ID). May be null: the missile then flies straight. */
+	UPROPERTY()
+	TObjectPtr<AActor> Target = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize Origin = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantize Velocity = FVector::ZeroVector;
+
+	/** Bumped on every launch so a pooled missile relaunched with similar values still triggers the OnRep. */
+	UPROPERTY()
+	uint8 LaunchId = 0;
+
+	/** False while the missile sits in the pool. */
+	UPROPERTY()
+	bool bActive = false;
+};
+
+/**
+ * @brief Guided missile that steers onto a target ship with proportional navigation.
+ *
+ * Missiles don't tick or replicate movement. Only LaunchState replicates; server and clients register the missile
+ * with USolaraqMissileSubsystem, which runs guidance for all of them in one pass. Missiles are pooled: launch them
+ * with USolaraqMissileSubsystem::LaunchMissile, and hits / expiry return them to the pool instead of destroying.
+ */
+UCLASS(Blueprintable)
+class SOLARAQ_API ASolaraqHomingMissile : public ASolaraqProjectile
+{
+	GENERATED_BODY()
+
+	// Guidance state lives in the subsystem's arrays
+	friend class USolaraqMissileSubsystem;
+
+public:
+	ASolaraqHomingMissile();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Navigation constant N: commanded turn rate = N * line-of-sight rate. 3-5 is typical. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|Guidance", meta = (ClampMin = "0.0"))
+	float NavigationConstant = 4.0f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|Guidance", meta = (ClampMin = "0.0"))
+	float MaxTurnRate = 180.0f; // Degrees per second
+
+	/** Cruise speed (cm/s); the launch velocity converges to this. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|Guidance", meta = (ClampMin = "0.0"))
+	float MissileSpeed = 4000.0f;
+
+	AActor* GetTarget() const { return LaunchState.Target; }
+	bool IsLaunched() const { return LaunchState.bActive; }
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Hit something: back to the pool rather than Destroy. */
+	virtual void DeactivateProjectile() override;
+
+	UFUNCTION()
+	void OnRep_LaunchState();
+
+private:
+	/** Server: (re)arms the missile from the pool. */
+	void Launch(const FVector& Origin, const FVector& Velocity, AActor* Target);
+
+	/** Server: disarms and hides the missile. */
+	void Park();
+
+	/** Shows/hides, places and (un)registers guidance to match LaunchState. Server and clients. */
+	void ApplyLaunchState();
+
+	UPROPERTY(ReplicatedUsing = OnRep_LaunchState)
+	FSolaraqMissileLaunchState LaunchState;
+
+	/** Index in USolaraqMissileSubsystem's guidance arrays, INDEX_NONE when not in flight. */
+	int32 GuidanceSlot = INDEX_NONE;
+
+	/** LaunchId last applied on this machine. */
+	uint8 AppliedLaunchId = 0;
+};
@@ -0,0 +1,74 @@
+// SolaraqMissileSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqMissileSubsystem.generated.h"
+
+class ASolaraqHomingMissile;
+class APawn;
+
+/**
+ * @brief Runs guidance for every missile in flight in one data-oriented pass, and pools missile actors.
+ *
+ * Per frame: gather missile and target kinematics into flat arrays, compute proportional navigation for all of them,
+ * write the new velocities back to the missiles' movement components. When a missile is not closing on its target
+ * (e.g. right after launch) it turns towards the lead point from ASolaraqAIController::CalculateInterceptPoint.
+ * Runs on server and clients; clients simulate guidance from the replicated launch state. The server also expires
+ * missiles and owns the pool.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqMissileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqMissileSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Server: takes a missile of the class from the pool (or spawns one) and launches it. */
+	ASolaraqHomingMissile* LaunchMissile(TSubclassOf<ASolaraqHomingMissile> MissileClass, const FTransform& SpawnTransform,
+		const FVector& Velocity, AActor* Target, AActor* Owner, APawn* Instigator);
+
+	/** Server: parks the missile and returns it to the pool. */
+	void ReleaseMissile(ASolaraqHomingMissile* Missile);
+
+	void RegisterGuidance(ASolaraqHomingMissile* Missile);
+	void UnregisterGuidance(ASolaraqHomingMissile* Missile);
+
+	int32 GetNumMissilesInFlight() const { return Missiles.Num(); }
+
+protected:
+	/** Parked missiles kept per class; extras are destroyed. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Weapon|Missiles", meta = (ClampMin = "0"))
+	int32 MaxPooledPerClass = 32;
+
+private:
+	void RemoveSlot(int32 Slot);
+
+	// --- Guidance arrays (parallel, one entry per missile in flight) ---
+	TArray<ASolaraqHomingMissile*> Missiles;
+	TArray<TWeakObjectPtr<AActor>> Targets;
+	TArray<FVector> Velocities;
+	TArray<double> ExpireTimes;
+
+	// --- Per-frame scratch ---
+	TArray<FVector> Positions;
+	TArray<FVector> TargetPositions;
+	TArray<FVector> TargetVelocities;
+	TArray<uint8> HasTarget;
+
+	/** Parked missiles by class (server). */
+	TMap<UClass*, TArray<TWeakObjectPtr<ASolaraqHomingMissile>>> Pool;
+};
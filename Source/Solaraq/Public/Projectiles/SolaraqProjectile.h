@@ -3,8 +3,29 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "Engine/NetSerialization.h"
 #include "SolaraqProjectile.generated.h" // Must be last include
 
+/** Initial conditions of a gravity-affected projectile. Clients rebuild the whole trajectory from these. */
+USTRUCT()
+struct FSolaraqBallisticLaunch
+{
+    GENERATED_BODY()
+
+    // Server simulates from the quantized values too, so both sides integrate identical inputs
+    UPROPERTY()
+    FVector_NetQuantize100 Origin = FVector::ZeroVector;
+
+    UPROPERTY()
+    FVector_NetQuantize100 Velocity = FVector::ZeroVector;
+
+    /** Server world time of the launch. */
+    UPROPERTY()
+    double LaunchTime = -1.0;
+
+    bool IsSet() const { return LaunchTime >= 0.0; }
+};
+
 // Forward Declarations
 class USphereComponent;
 class UStaticMeshComponent;
@@ -20,6 +41,8 @@ public:
     // Sets default values for this actor's properties
     ASolaraqProjectile();
 
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectile")
     float BaseDamage; // Make sure this is public or has a getter if you need it elsewhere
 
@@ -30,6 +53,7 @@ public:
 protected:
     // Called when the game starts or when spawned
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     // --- Components ---
 
@@ -56,12 +80,44 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "Projectile")
     float ProjectileLifeSpan = 5.0f;
 
+    // --- Celestial Gravity ---
+
+    /**
+     * Bend the trajectory under the summed gravity of all celestial bodies. The movement component is switched off
+     * and USolaraqProjectileGravitySubsystem integrates the projectile (identically on server and clients).
+     */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|Gravity")
+    bool bAffectedByCelestialGravity = false;
+
+    /** Acceleration (cm/s^2) per unit of a body's GravitationalStrength at full pull. */
+    UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Projectile|Gravity", meta = (ClampMin = "0.0", EditCondition = "bAffectedByCelestialGravity"))
+    float CelestialGravityScale = 0.01f;
+
+    UFUNCTION()
+    void OnRep_BallisticLaunch();
+
+    /** Registers with the gravity subsystem once the launch is known. Server and clients. */
+    void ApplyBallisticLaunch();
+
     // --- Collision Handling ---
 
     /** Function called when this projectile hits something */
     UFUNCTION()
     void OnOverlapBegin(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
 
+    /** Server: called after a hit. Destroys by default; pooled projectiles override to park instead. */
+    virtual void DeactivateProjectile();
+
+private:
+    friend class USolaraqProjectileGravitySubsystem;
+
+    /** Set by the gravity subsystem on the server the frame the projectile is fired. */
+    UPROPERTY(ReplicatedUsing = OnRep_BallisticLaunch)
+    FSolaraqBallisticLaunch BallisticLaunch;
+
+    /** Index in USolaraqProjectileGravitySubsystem's arrays, INDEX_NONE when not registered. */
+    int32 GravitySlot = INDEX_NONE;
+
 public:
     // --- Accessors ---
 
@@ -69,4 +125,6 @@ public:
     USphereComponent* GetCollisionComp() const { return CollisionComp; }
     /** Returns ProjectileMovement subobject **/
     UProjectileMovementComponent* GetProjectileMovement() const { return ProjectileMovement; }
+    /** Returns the lifespan in seconds (0 = infinite) **/
+    float GetProjectileLifeSpan() const { return ProjectileLifeSpan; }
 };
\ No newline at end of file
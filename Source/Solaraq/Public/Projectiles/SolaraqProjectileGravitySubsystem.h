@@ -0,0 +1,88 @@
+// SolaraqProjectileGravitySubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SolaraqProjectileGravitySubsystem.generated.h"
+
+class ASolaraqProjectile;
+
+/**
+ * @brief Integrates every gravity-affected projectile against celestial gravity in one pass per fixed step.
+ *
+ * Celestial bodies are static, so their positions, influence radii, strengths and falloff exponents are gathered once
+ * into flat arrays. Projectile positions and velocities live in parallel arrays; each fixed step applies the summed
+ * pull of all bodies (the same falloff curve ACelestialBodyBase uses on ships) with semi-implicit Euler.
+ *
+ * Steps sit on a global grid of server time (multiples of 1 / FixedStepRate). A projectile starts at its replicated
+ * launch time, takes one partial step to the first grid point, then follows the grid. Server and clients therefore
+ * integrate the same inputs with the same step sizes, and a late-joining client catches up to the same trajectory.
+ * Actors are placed at the integrated state extrapolated to the current time.
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqProjectileGravitySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqProjectileGravitySubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Server: fixes the launch from the projectile's spawn location and velocity at the end of this frame. */
+	void QueueLaunch(ASolaraqProjectile* Projectile);
+
+	/** Starts integrating a projectile whose BallisticLaunch is set. Server and clients. */
+	void RegisterProjectile(ASolaraqProjectile* Projectile);
+	void UnregisterProjectile(ASolaraqProjectile* Projectile);
+
+	int32 GetNumProjectiles() const { return Projectiles.Num(); }
+
+protected:
+	/** Integration steps per second. Must match between server and clients. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Weapon|Gravity", meta = (ClampMin = "10.0"))
+	float FixedStepRate = 60.0f;
+
+	/** Grid steps run in one frame before the rest is deferred to the next frame. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Weapon|Gravity", meta = (ClampMin = "1"))
+	int32 MaxStepsPerFrame = 8;
+
+private:
+	double GetServerTime() const;
+	double GetStepTime(int64 Step) const { return static_cast<double>(Step) / FixedStepRate; }
+
+	/** Advances projectile Index to ToTime (one step). */
+	void IntegrateTo(int32 Index, double ToTime);
+
+	void RemoveSlot(int32 Slot);
+
+	// --- Bodies (static after OnWorldBeginPlay) ---
+	TArray<FVector> BodyPositions;
+	TArray<float> BodyRadii;
+	TArray<float> BodyStrengths;
+	TArray<float> BodyExponents;
+
+	// --- Projectiles (parallel) ---
+	TArray<ASolaraqProjectile*> Projectiles;
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	TArray<double> SimTimes;
+	TArray<float> GravityScales;
+
+	/** Last grid step every registered projectile has been integrated to. */
+	int64 GridStep = -1;
+
+	/** Server: fired this frame, launch fixed in Tick. */
+	TArray<TPair<TWeakObjectPtr<ASolaraqProjectile>, double>> PendingLaunches;
+};
@@ -0,0 +1,101 @@
+// SolaraqSalvoSubsystem.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Projectiles/SolaraqSalvoTypes.h"
+#include "SolaraqSalvoSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UPrimitiveComponent;
+class UStaticMesh;
+struct FOverlapResult;
+
+/** One salvo in flight. Pellet positions are analytic: Origin + Velocities[i] * (Time - StartTime). */
+USTRUCT()
+struct FSolaraqActiveSalvo
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<const USolaraqSalvoPattern> Pattern = nullptr;
+
+	TWeakObjectPtr<AActor> Shooter;
+	FVector Origin = FVector::ZeroVector;
+	double StartTime = 0.0;
+	float SimulatedTime = 0.0f; // Flight time already checked for hits
+
+	TArray<FVector> Velocities;
+	TBitArray<> Alive;
+	int32 NumAlive = 0;
+
+	bool bApplyDamage = false; // Server only; clients just stop the pellet visuals on hit
+};
+
+/**
+ * @brief Simulates all salvo / spread weapon pellets without spawning actors.
+ *
+ * A shot arrives as one FSolaraqSalvoEvent (ASolaraqShipBase::Multicast_FireSalvo). Server and clients rebuild the
+ * pellets from the pattern and seed. Each frame, hits for a whole salvo are resolved with one overlap query over the
+ * bounds of all its pellet segments, followed by cheap segment-vs-sphere tests against the ships found.
+ * Only the server applies damage. Pellets are drawn with one instanced mesh per pellet mesh (not on dedicated servers).
+ */
+UCLASS(Config = Game)
+class SOLARAQ_API USolaraqSalvoSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Convenience accessor. Returns nullptr if the context has no world. */
+	static USolaraqSalvoSubsystem* Get(const UObject* WorldContextObject);
+
+	//~ Begin USubsystem Interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+	//~ End USubsystem Interface
+
+	//~ Begin FTickableGameObject Interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~ End FTickableGameObject Interface
+
+	/** Starts simulating a salvo. Called on server and clients from the replicated event. */
+	void LaunchSalvo(const FSolaraqSalvoEvent& Event, AActor* Shooter);
+
+	int32 GetNumActiveSalvos() const { return Salvos.Num(); }
+
+protected:
+	/** Oldest salvo is dropped beyond this. */
+	UPROPERTY(Config, EditDefaultsOnly, Category = "Solaraq|Weapon|Salvo", meta = (ClampMin = "1"))
+	int32 MaxActiveSalvos = 256;
+
+private:
+	void ResolveHits(FSolaraqActiveSalvo& Salvo, float FromTime, float ToTime);
+	void UpdateVisuals(double Now);
+	UInstancedStaticMeshComponent* GetOrCreatePelletMeshComponent(UStaticMesh* Mesh);
+
+	UPROPERTY()
+	TArray<FSolaraqActiveSalvo> Salvos;
+
+	/** Transient, non-replicated actor holding the pellet instanced meshes. */
+	UPROPERTY()
+	TObjectPtr<AActor> VisualsActor;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UStaticMesh>, TObjectPtr<UInstancedStaticMeshComponent>> PelletMeshComponents;
+
+	/** Reused per frame. */
+	TMap<UStaticMesh*, TArray<FTransform>> VisualTransforms;
+	TArray<FOverlapResult> OverlapScratch;
+
+	/** Earliest hit along each pellet's segment this frame, indexed like FSolaraqActiveSalvo::Velocities. */
+	struct FPelletHit
+	{
+		float Time = TNumericLimits<float>::Max();
+		AActor* Actor = nullptr;
+		UPrimitiveComponent* Component = nullptr;
+		FVector ImpactPoint = FVector::ZeroVector;
+	};
+	TArray<FPelletHit> PelletHitScratch;
+};
@@ -0,0 +1,94 @@
+// SolaraqSalvoTypes.h
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/NetSerialization.h"
+#include "SolaraqSalvoTypes.generated.h"
+
+class UStaticMesh;
+
+/**
+ * @brief Shape of a multi-pellet shot (shotgun, flak, swarm).
+ *
+ * Pellets are not actors. Everything about them follows from the pattern plus the seed in FSolaraqSalvoEvent, so
+ * the server and every client reconstruct identical trajectories (see USolaraqSalvoSubsystem).
+ */
+UCLASS(BlueprintType)
+class SOLARAQ_API USolaraqSalvoPattern : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (ClampMin = "1", ClampMax = "64"))
+	int32 PelletCount = 8;
+
+	/** Total fan width in degrees. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (ClampMin = "0.0", ClampMax = "360.0"))
+	float SpreadAngle = 20.0f;
+
+	/** Evenly spaced fan (plus jitter) instead of uniformly random directions. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo")
+	bool bEvenSpread = true;
+
+	/** Evenly spaced pellets are offset by up to this fraction of their spacing. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (EditCondition = "bEvenSpread", ClampMin = "0.0", ClampMax = "1.0"))
+	float SpreadJitter = 0.25f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (ClampMin = "0.0", ForceUnits = "cm/s"))
+	float PelletSpeed = 6000.0f;
+
+	/** Each pellet's speed is scaled by a random factor in [1 - SpeedVariance, 1 + SpeedVariance]. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float SpeedVariance = 0.1f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (ClampMin = "0.01"))
+	float PelletLifetime = 1.5f;
+
+	/** Added to the ship collision radius when testing hits. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (ClampMin = "0.0"))
+	float PelletRadius = 10.0f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo", meta = (ClampMin = "0.0"))
+	float DamagePerPellet = 5.0f;
+
+	/** Drawn with one instanced mesh per pattern mesh. Optional. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo|Visuals")
+	TObjectPtr<UStaticMesh> PelletMesh;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Salvo|Visuals")
+	FVector PelletMeshScale = FVector(0.2f);
+
+	/** Deterministic pellet velocities for one shot. Same inputs give the same output everywhere. */
+	void GeneratePelletVelocities(int32 Seed, const FVector& Direction, const FVector& InheritedVelocity, TArray<FVector>& OutVelocities) const;
+
+	float GetRange() const { return PelletSpeed * PelletLifetime; }
+};
+
+/** Everything needed to reconstruct a salvo. Sent once per shot instead of one replicated actor per pellet. */
+USTRUCT()
+struct SOLARAQ_API FSolaraqSalvoEvent
+{
+	GENERATED_BODY()
+
+	/** Pattern asset, sent as a network GUID (i.e. a pattern ID). */
+	UPROPERTY()
+	TObjectPtr<const USolaraqSalvoPattern> Pattern = nullptr;
+
+	UPROPERTY()
+	int32 Seed = 0;
+
+	UPROPERTY()
+	FVector_NetQuantize Origin = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantizeNormal Direction = FVector::ForwardVector;
+
+	/** Shooter velocity, added to every pellet. */
+	UPROPERTY()
+	FVector_NetQuantize InheritedVelocity = FVector::ZeroVector;
+
+	/** Rounds the vectors to what clients receive, so the server simulates the same pellets they draw. */
+	void Quantize();
+};